@@ -0,0 +1,24 @@
+#include "Halide.h"
+
+using namespace Halide;
+
+int main(int argc, char* argv[]) {
+    ImageParam in{Float(32), 2, "input"};
+
+    Func blur_x{"blur_x"}, blur_y{"blur_y"};
+    Var x, y;
+
+    blur_x(x, y) = (in(x, y) + in(x + 1, y) + in(x + 2, y)) / 3.0f;
+    blur_y(x, y) = (blur_x(x, y) + blur_x(x, y + 1) + blur_x(x, y + 2)) / 3.0f;
+
+    // The temporary buffer is computed at the root, as in the Tiramisu
+    // code, but allocated without first touch or huge pages.
+    blur_x.compute_root().parallel(y).vectorize(x, 8);
+    blur_y.parallel(y).vectorize(x, 8);
+
+    blur_y.compile_to_object("build/generated_fct_blurxynuma_ref.o", {in}, "blurxynuma_ref");
+
+    blur_y.compile_to_lowered_stmt("build/generated_fct_blurxynuma_ref.txt", {in}, Text);
+
+    return 0;
+}
@@ -0,0 +1,45 @@
+#include <tiramisu/tiramisu.h>
+
+// The image should be much larger than the last level cache so that the
+// placement of the pages matters.
+#define IMG_WIDTH 8192
+#define IMG_HEIGHT 8192
+
+using namespace tiramisu;
+
+int main(int argc, char **argv)
+{
+    tiramisu::init("blurxynuma_tiramisu");
+
+    tiramisu::var y("y", 0, IMG_HEIGHT), x("x", 0, IMG_WIDTH);
+    tiramisu::var yb("yb", 0, IMG_HEIGHT + 2);
+    tiramisu::var yi("yi", 0, IMG_HEIGHT + 2), xi("xi", 0, IMG_WIDTH + 2);
+
+    tiramisu::input in("in", {yi, xi}, p_float32);
+
+    tiramisu::computation blur_x({yb, x}, (in(yb, x) + in(yb, x + 1) + in(yb, x + 2)) / 3.0f);
+    tiramisu::computation blur_y({y, x}, (blur_x(y, x) + blur_x(y + 1, x) + blur_x(y + 2, x)) / 3.0f);
+
+    blur_y.after(blur_x, computation::root);
+
+    blur_x.parallelize(yb);
+    blur_x.vectorize(x, 8);
+    blur_y.parallelize(y);
+    blur_y.vectorize(x, 8);
+
+    // The temporary buffer is large: place its pages on the nodes of the
+    // threads that use them and back it with huge pages.
+    tiramisu::buffer b_blur_x("b_blur_x", {IMG_HEIGHT + 2, IMG_WIDTH}, p_float32, a_temporary);
+    b_blur_x.set_numa_first_touch(true);
+    b_blur_x.set_huge_pages(true);
+    blur_x.store_in(&b_blur_x);
+
+    tiramisu::buffer b_in("b_in", {IMG_HEIGHT + 2, IMG_WIDTH + 2}, p_float32, a_input);
+    tiramisu::buffer b_blur_y("b_blur_y", {IMG_HEIGHT, IMG_WIDTH}, p_float32, a_output);
+    in.store_in(&b_in);
+    blur_y.store_in(&b_blur_y);
+
+    tiramisu::codegen({&b_in, &b_blur_y}, "build/generated_fct_blurxynuma.o");
+
+    return 0;
+}
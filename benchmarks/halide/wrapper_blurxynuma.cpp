@@ -0,0 +1,57 @@
+#include "wrapper_blurxynuma.h"
+#include "../benchmarks.h"
+
+#include "Halide.h"
+#include "tiramisu/utils.h"
+#include <cstdlib>
+#include <iostream>
+
+#define IMG_WIDTH 8192
+#define IMG_HEIGHT 8192
+
+int main(int, char**)
+{
+    std::vector<std::chrono::duration<double,std::milli>> duration_vector_1;
+    std::vector<std::chrono::duration<double,std::milli>> duration_vector_2;
+
+    Halide::Buffer<float> input(IMG_WIDTH + 2, IMG_HEIGHT + 2);
+    for (int y = 0; y < IMG_HEIGHT + 2; y++)
+        for (int x = 0; x < IMG_WIDTH + 2; x++)
+            input(x, y) = (x + 3 * y) % 256;
+
+    Halide::Buffer<float> output1(IMG_WIDTH, IMG_HEIGHT);
+    Halide::Buffer<float> output2(IMG_WIDTH, IMG_HEIGHT);
+
+    // Warm up
+    blurxynuma_tiramisu(input.raw_buffer(), output1.raw_buffer());
+    blurxynuma_ref(input.raw_buffer(), output2.raw_buffer());
+
+    // Tiramisu (first touch and huge pages for the temporary buffer)
+    for (int i=0; i<NB_TESTS; i++)
+    {
+        auto start1 = std::chrono::high_resolution_clock::now();
+        blurxynuma_tiramisu(input.raw_buffer(), output1.raw_buffer());
+        auto end1 = std::chrono::high_resolution_clock::now();
+        std::chrono::duration<double,std::milli> duration1 = end1 - start1;
+        duration_vector_1.push_back(duration1);
+    }
+
+    // Reference
+    for (int i=0; i<NB_TESTS; i++)
+    {
+        auto start2 = std::chrono::high_resolution_clock::now();
+        blurxynuma_ref(input.raw_buffer(), output2.raw_buffer());
+        auto end2 = std::chrono::high_resolution_clock::now();
+        std::chrono::duration<double,std::milli> duration2 = end2 - start2;
+        duration_vector_2.push_back(duration2);
+    }
+
+    print_time("performance_CPU.csv", "blurxynuma",
+               {"Tiramisu", "Halide"},
+               {median(duration_vector_1), median(duration_vector_2)});
+
+    if (CHECK_CORRECTNESS)
+      compare_buffers("blurxynuma",  output1, output2);
+
+    return 0;
+}
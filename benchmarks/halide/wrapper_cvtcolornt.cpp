@@ -0,0 +1,71 @@
+#include "wrapper_cvtcolornt.h"
+#include "../benchmarks.h"
+
+#include "Halide.h"
+#include "halide_image_io.h"
+#include "tiramisu/utils.h"
+#include <cstdlib>
+#include <iostream>
+
+// The image should be much larger than the last level cache so that the
+// benchmark measures the memory bandwidth.
+#define IMG_WIDTH 8192
+#define IMG_HEIGHT 8192
+
+int main(int, char**)
+{
+    std::vector<std::chrono::duration<double,std::milli>> duration_vector_1;
+    std::vector<std::chrono::duration<double,std::milli>> duration_vector_2;
+
+    Halide::Buffer<uint8_t> input(IMG_WIDTH, IMG_HEIGHT, 3);
+    for (int c = 0; c < 3; c++)
+        for (int y = 0; y < IMG_HEIGHT; y++)
+            for (int x = 0; x < IMG_WIDTH; x++)
+                input(x, y, c) = (x + 3 * y + 7 * c) % 256;
+
+    Halide::Buffer<int32_t> SIZES_b(2);
+    SIZES_b(0) = input.extent(0);
+    SIZES_b(1) = input.extent(1);
+    Halide::Buffer<uint8_t> output1(input.width(), input.height());
+    Halide::Buffer<uint8_t> output2(input.width(), input.height());
+
+    // Warm up code.
+    cvtcolornt_tiramisu(SIZES_b.raw_buffer(), input.raw_buffer(), output1.raw_buffer());
+    cvtcolornt_ref(input.raw_buffer(), output2.raw_buffer());
+
+    // Tiramisu (non-temporal stores)
+    for (int i=0; i<NB_TESTS; i++)
+    {
+        auto start1 = std::chrono::high_resolution_clock::now();
+        cvtcolornt_tiramisu(SIZES_b.raw_buffer(), input.raw_buffer(), output1.raw_buffer());
+        auto end1 = std::chrono::high_resolution_clock::now();
+        std::chrono::duration<double,std::milli> duration1 = end1 - start1;
+        duration_vector_1.push_back(duration1);
+    }
+
+    // Reference (regular stores)
+    for (int i=0; i<NB_TESTS; i++)
+    {
+        auto start2 = std::chrono::high_resolution_clock::now();
+        cvtcolornt_ref(input.raw_buffer(), output2.raw_buffer());
+        auto end2 = std::chrono::high_resolution_clock::now();
+        std::chrono::duration<double,std::milli> duration2 = end2 - start2;
+        duration_vector_2.push_back(duration2);
+    }
+
+    print_time("performance_CPU.csv", "cvtcolornt",
+               {"Tiramisu", "Halide"},
+               {median(duration_vector_1), median(duration_vector_2)});
+
+    // Bytes read and written by one run (without the read-for-ownership
+    // traffic that non-temporal stores avoid).
+    double bytes = 4.0 * IMG_WIDTH * IMG_HEIGHT;
+    std::cout << "Effective bandwidth (GB/s): Tiramisu "
+              << bytes / (median(duration_vector_1) * 1e6) << ", Halide "
+              << bytes / (median(duration_vector_2) * 1e6) << std::endl;
+
+    if (CHECK_CORRECTNESS)
+	compare_buffers("benchmark_cvtcolornt", output1, output2);
+
+    return 0;
+}
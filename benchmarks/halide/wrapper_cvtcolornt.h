@@ -0,0 +1,21 @@
+#ifndef HALIDE__build___wrapper_cvtcolornt_o_h
+#define HALIDE__build___wrapper_cvtcolornt_o_h
+
+#include <tiramisu/utils.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+int cvtcolornt_tiramisu(halide_buffer_t *SIZES, halide_buffer_t *_b_input_buffer, halide_buffer_t *_b_blury_buffer);
+int cvtcolornt_tiramisu_argv(void **args);
+int cvtcolornt_ref(halide_buffer_t *_b_input_buffer, halide_buffer_t *_b_blury_buffer);
+int cvtcolornt_ref_argv(void **args);
+// Result is never null and points to constant static data
+const struct halide_filter_metadata_t *cvtcolornt_tiramisu_metadata();
+const struct halide_filter_metadata_t *cvtcolornt_ref_metadata();
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+#endif
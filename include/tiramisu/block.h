@@ -61,6 +61,7 @@ public:
     void interchange(var L0, var L1) override;
     void interchange(int L0, int L1) override;
     void parallelize(var L) override;
+    void parallelize(var L, parallel_schedule_t policy, int chunk_size = 0) override;
     void shift(var L0, int n) override;
     void skew(var i, var j, int f, var ni, var nj) override;
     void skew(var i, var j, var k, int factor, var ni, var nj, var nk) override;
@@ -89,6 +90,8 @@ public:
     void unroll(var L, int fac, var L_outer, var L_inner) override;
     void vectorize(var L, int v) override;
     void vectorize(var L, int v, var L_outer, var L_inner) override;
+    void vectorize(var L, int v, vector_tail_t tail) override;
+    void vectorize(var L, int v, vector_tail_t tail, var L_outer, var L_inner) override;
     // @}
 };  // class block
 
@@ -12,6 +12,7 @@
 #include <isl/constraint.h>
 
 #include <map>
+#include <set>
 #include <string.h>
 #include <stdint.h>
 #include <unordered_map>
@@ -39,6 +40,7 @@ class send;
 class recv;
 class send_recv;
 class wait;
+class collective;
 class sync;
 class xfer_prop;
 class auto_scheduler;
@@ -82,7 +84,28 @@ enum xfer_attr {
     CPU2CPU,
     CPU2GPU,
     GPU2CPU,
-    GPU2GPU
+    GPU2GPU,
+    RMA_PUT,
+    RMA_GET
+};
+
+/**
+ * The collective operations (see tiramisu::collective).
+ */
+enum collective_t {
+    ALLREDUCE,
+    BROADCAST,
+    ALLGATHER,
+    REDUCE_SCATTER
+};
+
+/**
+ * The reduction operators of the collective reductions (ALLREDUCE and REDUCE_SCATTER).
+ */
+enum reduction_t {
+    REDUCE_SUM,
+    REDUCE_MAX,
+    REDUCE_MIN
 };
 
 struct xfer {
@@ -159,6 +182,25 @@ private:
      */
     int rank_offset = 0;
 
+    /**
+     * True if the leading dimensions of buffers should be padded
+     * automatically during code generation (see pad_buffers()).
+     */
+    bool automatic_buffer_padding = false;
+
+    /**
+     * True if the automatic padding should also be applied to the input
+     * and output buffers of the function.
+     */
+    bool pad_argument_buffers = false;
+
+    /**
+     * True if the blocking MPI transfers that are repeated with the same
+     * arguments by a loop should use persistent requests (see
+     * set_persistent_communication()).
+     */
+    bool persistent_communication = false;
+
     /**
       * Function arguments. These are the buffers or scalars that are
       * passed to the function.
@@ -194,6 +236,13 @@ private:
       */
     std::vector<std::pair<std::string, int>> parallel_dimensions;
 
+    /**
+      * The scheduling policies of the parallel dimensions that do not use
+      * the default policy.  Each tuple contains the name of a computation,
+      * a loop level, the policy and the chunk size.
+      */
+    std::vector<std::tuple<std::string, int, tiramisu::parallel_schedule_t, int>> parallel_schedules;
+
     /**
       * A vector representing the vectorized dimensions around
       * the computations of the function.
@@ -205,6 +254,13 @@ private:
       */
     std::vector<std::tuple<std::string, int, int>> vector_dimensions;
 
+    /**
+      * The vectorized dimensions whose last vector is not executed by a
+      * scalar epilogue (see computation::vectorize()).  Each tuple
+      * contains the name of a computation, a loop level and the mode.
+      */
+    std::vector<std::tuple<std::string, int, tiramisu::vector_tail_t>> vector_tails;
+
     /**
       * A vector representing the distributed dimensions around
       * the computations of the function.
@@ -216,6 +272,14 @@ private:
       */
     std::vector<std::pair<std::string, int>> distributed_dimensions;
 
+    /**
+      * The distribution policies of the distributed dimensions that are not
+      * distributed one iteration per rank.  Each tuple contains the name of
+      * a computation, a loop level, the policy, the block size and the
+      * weight of each rank (the number of ranks is the number of weights).
+      */
+    std::vector<std::tuple<std::string, int, tiramisu::distribution_t, int, std::vector<int>>> distribution_policies;
+
     /**
       * A vector representing the GPU block dimensions around
       * the computations of the function.
@@ -249,6 +313,70 @@ private:
       */
     std::vector<std::tuple<std::string, int, int>> unroll_dimensions;
 
+    /**
+      * The loop levels that should be unrolled and jammed.  Each tuple
+      * <computation_name, level, factor> indicates that the loop level
+      * around the computation should be unrolled by factor and its copies
+      * jammed into the innermost loop (see computation::unroll_and_jam()).
+      */
+    std::vector<std::tuple<std::string, int, int>> unroll_and_jam_dimensions;
+
+    /**
+      * The loop levels whose invariant accesses should be promoted to
+      * registers (see computation::promote_to_register()).  Each pair
+      * contains the name of a computation and a loop level.
+      */
+    std::vector<std::pair<std::string, int>> register_promotions;
+
+    /**
+      * A vector representing the prefetches that should be inserted in the
+      * loops around the computations of the function.
+      * Prefetches are identified using the tuple
+      * <computation_name, level0, buffer_name, distance>, for example the
+      * tuple <S0, 1, b0, 4> indicates that at each iteration of the loop
+      * with level 1 around the computation S0, the elements of b0 that S0
+      * accesses 4 iterations later should be prefetched.  A distance of 0
+      * means that the distance is computed automatically.
+      */
+    std::vector<std::tuple<std::string, int, std::string, int>> prefetch_dimensions;
+
+    /**
+      * The names of the computations whose stores should be non-temporal
+      * (i.e., should bypass the cache).
+      */
+    std::vector<std::string> nontemporal_stores;
+
+    /**
+      * The names of the computations whose updates should be performed
+      * with atomic read-modify-write operations when they are executed in
+      * parallel.
+      */
+    std::vector<std::string> atomic_updates;
+
+    /**
+      * The computations that can be executed as concurrent tasks (see
+      * computation::tag_task_parallel()).
+      */
+    std::vector<std::string> task_parallel_computations;
+
+    /**
+      * The loop levels that should be executed as pipelined wavefronts
+      * (see computation::wavefront_pipeline()).  Each tuple contains the
+      * name of a computation, a loop level L, and the synchronization
+      * lags: a pair (k, lag) means that the iteration j of the loop level
+      * L+1 in the iteration i of L should wait until the iteration j + lag
+      * is done in the iteration i - k.
+      */
+    std::vector<std::tuple<std::string, int, std::vector<std::pair<int, int>>>> wavefront_pipelines;
+
+    /**
+      * The loop nests that should be collapsed into a single loop (see
+      * computation::collapse()).  Each tuple contains the name of a
+      * computation, the outermost collapsed loop level and the number
+      * of collapsed loop levels.
+      */
+    std::vector<std::tuple<std::string, int, int>> collapsed_loops;
+
     /**
       * Body of the function (a vector of computations).
       * The order of the computations in the vector does not have any
@@ -299,6 +427,14 @@ private:
       */
     void add_parallel_dimension(std::string computation_name, int vec_dim);
 
+    /**
+      * Distribute the iterations of the parallel dimension \p dim of the
+      * computation \p computation_name using the policy \p policy and
+      * chunks of \p chunk_size iterations.
+      */
+    void add_parallel_schedule(std::string computation_name, int dim,
+                               tiramisu::parallel_schedule_t policy, int chunk_size);
+
     /**
       * Tag the dimension \p dim of the computation \p computation_name to
       * be vectorized. \p len is the vector length.
@@ -307,6 +443,12 @@ private:
       */
     void add_vector_dimension(std::string computation_name, int vec_dim, int len);
 
+    /**
+      * Execute the last vector of the vectorized dimension \p vec_dim of
+      * the computation \p computation_name using the mode \p tail.
+      */
+    void add_vector_tail(std::string computation_name, int vec_dim, tiramisu::vector_tail_t tail);
+
     /**
       * Tag the dimension \p dim of the computation \p computation_name to
       * be distributed.
@@ -315,6 +457,15 @@ private:
       */
     void add_distributed_dimension(std::string computation_name, int dim);
 
+    /**
+      * Distribute the iterations of the distributed dimension \p dim of the
+      * computation \p computation_name over weights.size() ranks using the
+      * policy \p policy, blocks of \p block_size iterations and the weights
+      * \p weights.
+      */
+    void add_distribution_policy(std::string computation_name, int dim, tiramisu::distribution_t policy,
+                                 int block_size, std::vector<int> weights);
+
     /**
       * Tag the loop level \p L of the computation
       * \p computation_name to be unrolled.
@@ -324,6 +475,55 @@ private:
       */
     void add_unroll_dimension(std::string stmt_name, int L, int factor);
 
+    /**
+      * Unroll the loop level \p L of the computation \p stmt_name by
+      * \p factor and jam the copies into the innermost loop.
+      */
+    void add_unroll_and_jam_dimension(std::string stmt_name, int L, int factor);
+
+    /**
+      * Promote the accesses that are invariant in the loop level \p L of
+      * the computation \p stmt_name to registers.
+      */
+    void add_register_promotion(std::string stmt_name, int L);
+
+    /**
+      * Prefetch the buffer \p buffer_name at the loop level \p L of the
+      * computation \p computation_name, \p distance iterations ahead.
+      * The dimension 0 represents the outermost loop level (it
+      * corresponds to the leftmost dimension in the iteration space).
+      * A \p distance of 0 means that the distance is computed
+      * automatically.
+      */
+    void add_prefetch_dimension(std::string stmt_name, int L, std::string buffer_name, int distance);
+
+    /**
+      * Make the stores of the computation \p stmt_name non-temporal.
+      */
+    void add_nontemporal_store(std::string stmt_name);
+
+    /**
+      * Perform the updates of the computation \p stmt_name atomically.
+      */
+    void add_atomic_update(std::string stmt_name);
+
+    /**
+      * Allow the computation \p stmt_name to be executed as a task.
+      */
+    void add_task_parallel_computation(std::string stmt_name);
+
+    /**
+      * Execute the loop level \p L of the computation \p stmt_name as a
+      * pipelined wavefront, with the synchronization lags \p lags.
+      */
+    void add_wavefront_pipeline(std::string stmt_name, int L, std::vector<std::pair<int, int>> lags);
+
+    /**
+      * Collapse the \p n loop levels of the computation \p stmt_name
+      * that start at the loop level \p L into a single loop.
+      */
+    void add_collapsed_loops(std::string stmt_name, int L, int n);
+
     /**
      * Get live in/out computations in the function.
      */
@@ -642,12 +842,30 @@ protected:
      */
     int get_vector_length(const std::string &comp, int lev) const;
 
+    /**
+     * Return how the last vector of the vectorized loop level \p lev of
+     * the computation \p comp is executed.
+     */
+    tiramisu::vector_tail_t get_vector_tail(const std::string &comp, int lev) const;
+
     /**
      * If the computation \p comp is unrolled at the loop level \p lev,
      * return its unrolling factor.
      */
     int get_unrolling_factor(const std::string &comp, int lev) const;
 
+    /**
+     * If the loop level \p lev of the computation \p comp is unrolled
+     * and jammed, return the unrolling factor, otherwise return 0.
+     */
+    int get_unroll_and_jam_factor(const std::string &comp, int lev) const;
+
+    /**
+     * Return true if the accesses that are invariant in the loop level
+     * \p lev of the computation \p comp should be promoted to registers.
+     */
+    bool should_promote_to_register(const std::string &comp, int lev) const;
+
    /**
      * Return true if the usage of high level scheduling comments is valid; i.e. if
      * the scheduling relations formed using before, after, compute_at, etc.. form a tree.
@@ -711,12 +929,74 @@ protected:
       */
     bool should_parallelize(const std::string &comp, int lev) const;
 
+    /**
+      * Return the scheduling policy and the chunk size of the parallel
+      * loop level \p lev of the computation \p comp.
+      */
+    std::pair<tiramisu::parallel_schedule_t, int> get_parallel_schedule(const std::string &comp, int lev) const;
+
     /**
       * Return true if the computation \p comp should be unrolled
       * at the loop level \p lev.
       */
     bool should_unroll(const std::string &comp, int lev) const;
 
+    /**
+      * Return true if a buffer should be prefetched at the loop level
+      * \p lev of the computation \p comp.
+      */
+    bool should_prefetch(const std::string &comp, int lev) const;
+
+    /**
+      * Return true if the loop level \p lev of the computation \p comp
+      * should be executed as a pipelined wavefront.
+      */
+    bool should_pipeline_wavefront(const std::string &comp, int lev) const;
+
+    /**
+      * Return the synchronization lags of the pipelined wavefront at the
+      * loop level \p lev of the computation \p comp.
+      */
+    std::vector<std::pair<int, int>> get_wavefront_lags(const std::string &comp, int lev) const;
+
+    /**
+      * Return the number of loop levels, starting at the loop level
+      * \p lev, that should be collapsed into a single loop for the
+      * computation \p comp.  Return 0 if the loop level \p lev should
+      * not be collapsed.
+      */
+    int get_collapse_depth(const std::string &comp, int lev) const;
+
+    /**
+      * Return the buffers that should be prefetched at the loop level
+      * \p lev of the computation \p comp, each with its prefetch
+      * distance (0 if the distance should be computed automatically).
+      */
+    std::vector<std::pair<std::string, int>> get_prefetches(const std::string &comp, int lev) const;
+
+    /**
+      * Return the names of the buffers where the computations tagged with
+      * tag_nontemporal_store() are stored.
+      */
+    std::vector<std::string> get_nontemporal_buffers() const;
+
+    /**
+      * Return true if the stores of the computation \p comp should be
+      * non-temporal.
+      */
+    bool should_store_nontemporally(const std::string &comp) const;
+
+    /**
+      * Return true if the updates of the computation \p comp should be
+      * performed atomically.
+      */
+    bool should_update_atomically(const std::string &comp) const;
+
+    /**
+      * Return true if the computation \p comp can be executed as a task.
+      */
+    bool should_run_as_task(const std::string &comp) const;
+
     /**
       * Return true if the computation \p comp should be vectorized
       * at the loop level \p lev.
@@ -729,6 +1009,13 @@ protected:
       */
     bool should_distribute(const std::string &comp, int lev) const;
 
+    /**
+      * Return the distribution policy, the block size and the weights of the
+      * ranks of the distributed loop level \p lev of the computation \p comp.
+      */
+    std::tuple<tiramisu::distribution_t, int, std::vector<int>> get_distribution_policy(const std::string &comp,
+                                                                                        int lev) const;
+
     /**
       * This computation requires a call to the MPI_Comm_rank function.
       */
@@ -744,6 +1031,13 @@ protected:
       */
     void lift_dist_comps();
 
+    /**
+      * Return the number of requests that the nonblocking transfers of the
+      * function can have in flight, i.e., the number of elements of their
+      * request buffers.  This is used to size the pool of MPI requests.
+      */
+    int get_nonblocking_request_count() const;
+
     /**
       * The set of all computations that have no computation scheduled before them.
       * Does not include allocation computations created using
@@ -853,6 +1147,85 @@ public:
      */
     void allocate_and_map_buffers_automatically();
 
+    /**
+     * \brief Pad the leading dimensions of buffers to avoid cache-set
+     * conflicts and 4K aliasing.
+     *
+     * \details For each access in the function, this pass computes the
+     * distance (in bytes) between the buffer elements accessed by two
+     * consecutive iterations of the innermost loop under the final schedule.
+     * If that distance is a multiple of 1024 bytes (for example a column-wise
+     * traversal of a 1024x1024 float matrix), consecutive accesses map to a
+     * handful of cache sets and evict each other.  In that case the inner
+     * dimensions of the buffer are padded by one cache line (64 bytes) until
+     * the distance is no longer a multiple of 1024 bytes.  The outermost
+     * dimension is never padded.
+     *
+     * Only buffers with constant extents allocated in the host memory are
+     * padded.  Temporary buffers are always candidates.  Input and output
+     * buffers are padded only if \p pad_arguments is true; in that case
+     * the caller must allocate (and pass) the input and output buffers with
+     * the padded sizes, which can be retrieved with buffer::get_dim_sizes().
+     *
+     * The chosen padding is printed on stdout and returned: the returned map
+     * associates the name of each padded buffer with the number of elements
+     * added to each of its dimensions.
+     *
+     * This pass must be called after scheduling and after the arguments of
+     * the function are set (function::set_arguments()).  Use
+     * set_automatic_buffer_padding() to have it called automatically by
+     * function::codegen().
+     */
+    std::map<std::string, std::vector<int>> pad_buffers(bool pad_arguments = false);
+
+    /**
+     * \brief Pad the buffers accessed by loops vectorized with a v_padded
+     * tail.
+     *
+     * \details The last vector iteration of such a loop runs up to v - 1
+     * iterations past the end of the loop.  For each access of the
+     * computation, the dimensions of the buffer that advance with the
+     * vectorized loop are enlarged by (v - 1) times the distance between
+     * the elements accessed by two consecutive iterations, so that the
+     * extra lanes stay within the buffer.
+     *
+     * Temporary buffers are always padded.  Input and output buffers are
+     * padded only if the padding of arguments is enabled (see
+     * set_automatic_buffer_padding()); in that case the caller must
+     * allocate them with the padded sizes (buffer::get_dim_sizes()).
+     * Otherwise, and for accesses that cannot be padded (non-constant
+     * distance or extents, decreasing accesses, device buffers), an error
+     * is reported: use the v_masked tail instead.
+     *
+     * This pass is called by function::codegen() once the arguments of the
+     * function are set.
+     */
+    void pad_buffers_for_vector_tails();
+
+    /**
+     * \brief Enable (or disable) the automatic padding of buffers during
+     * code generation.
+     *
+     * \details If \p pad is true, function::codegen() calls
+     * pad_buffers(\p pad_arguments) once the arguments of the function are
+     * known.  By default automatic padding is disabled.
+     */
+    void set_automatic_buffer_padding(bool pad, bool pad_arguments = false);
+
+    /**
+     * \brief Enable (or disable) persistent MPI requests for the transfers
+     * repeated by a loop.
+     *
+     * \details If \p enable is true, the blocking MPI sends and receives
+     * whose count, peer, tag, guard and buffer address do not change across
+     * the iterations of a sequential loop (for example the halo exchanges
+     * of a time loop) are initialized once before that loop with
+     * MPI_Send_init/MPI_Recv_init.  Each run of consecutive transfers in the
+     * loop body is then started with MPI_Startall and completed with
+     * MPI_Waitall.  By default persistent requests are not used.
+     */
+    void set_persistent_communication(bool enable);
+
     /**
       * \brief Compute the bounds of each computation.
       *
@@ -980,6 +1353,31 @@ public:
       */
     void gen_c_code() const;
 
+    /**
+      * \brief Infer the data that each rank needs and generate the communication
+      * that moves it.
+      *
+      * \details The computations of the function that have a distributed loop
+      * (the outermost loop, see tag_distribute_level()) are analyzed as follows:
+      * - The inputs of the function (computations without an expression that are
+      * not distributed) are assumed to be held by the rank \p root only.  The
+      * elements of an input that a rank reads to compute its part of the
+      * distributed computations are sent to it by \p root (scatter) before the
+      * first computation of the function.
+      * - The data produced by other distributed computations is exchanged between
+      * the ranks as with computation::gen_communication().
+      * - The elements of the distributed computations that are stored in an output
+      * buffer are sent by the rank that computes them to \p root (gather) after
+      * the last computation of the function.
+      *
+      * The scattered and gathered elements are stored at the place given by the
+      * access relation of their computation, i.e. the buffers have the same
+      * layout on every rank.  The computations of the function must be ordered
+      * with then(), before(), ... and computation::gen_communication() must not
+      * be called on them.
+      */
+    void gen_data_distribution(int root = 0);
+
     /**
       * \brief Generate an object file that contains the compiled function.
       * \details This function relies on Halide to generate the object file.
@@ -1147,6 +1545,25 @@ private:
      */
     cuda_ast::memory_location location;
 
+    /**
+      * A boolean indicating whether the pages of the buffer should be
+      * touched in parallel right after its allocation, so that they are
+      * placed on the NUMA nodes of the threads that use them.
+      */
+    bool numa_first_touch;
+
+    /**
+      * A boolean indicating whether the buffer should be backed by huge
+      * pages when possible.
+      */
+    bool huge_pages;
+
+    /**
+      * A boolean indicating whether the buffer should be allocated in
+      * memory shared by the MPI ranks of a node.
+      */
+    bool node_shared;
+
 protected:
     /**
      * Set the type of the argument. Three possible types exist:
@@ -1169,6 +1586,23 @@ protected:
       */
     bool get_automatic_gpu_copy();
 
+    /**
+      * Return whether the pages of the buffer should be touched in
+      * parallel after its allocation.
+      */
+    bool get_numa_first_touch();
+
+    /**
+      * Return whether the buffer should be backed by huge pages.
+      */
+    bool get_huge_pages();
+
+    /**
+      * Return whether the buffer should be allocated in memory shared by
+      * the MPI ranks of a node.
+      */
+    bool get_node_shared();
+
     /**
      * Set the size of a dimension of the buffer.
      */
@@ -1358,6 +1792,56 @@ public:
       */
     void set_automatic_gpu_copy(bool automatic_gpu_copy);
 
+    /**
+      * Set whether the pages of the buffer should be touched in parallel
+      * right after the buffer is allocated.
+      *
+      * On NUMA machines, a page is placed on the node of the thread that
+      * touches it first.  If the buffer is first written by one thread
+      * (or by a serial loop) and then used by a parallel loop, the
+      * threads running on the other nodes pay remote memory accesses.
+      * When this option is set, the buffer is touched right after its
+      * allocation by a parallel loop over its outermost dimension (one
+      * write per page), which matches the common schedule where the
+      * loop over the outermost dimension is parallelized.
+      *
+      * Only buffers allocated automatically on the host are concerned.
+      */
+    void set_numa_first_touch(bool numa_first_touch);
+
+    /**
+      * Set whether the buffer should be backed by huge pages.
+      *
+      * This reduces TLB misses for large buffers.  The allocation is
+      * advised to use transparent huge pages (madvise(MADV_HUGEPAGE) on
+      * Linux); the advice is ignored on systems that do not support it.
+      *
+      * Only buffers allocated automatically on the host are concerned.
+      */
+    void set_huge_pages(bool huge_pages);
+
+    /**
+      * Set whether the buffer should be allocated in memory shared by the
+      * MPI ranks of a node (see tiramisu_MPI_alloc_node_shared()).
+      *
+      * The one-sided transfers (RMA_PUT, RMA_GET) between the ranks of a
+      * node on such a buffer are then copies through the mapping of the
+      * buffer of the peer instead of MPI_Put/MPI_Get.  Two-sided transfers
+      * and the transfers to the ranks of other nodes still go through MPI.
+      * The allocation is collective over the ranks of a node, so every rank
+      * must call the function.
+      *
+      * There is no separate mode that maps the ranks of a node to threads:
+      * nesting a loop tagged with tag_parallel_level() in a loop tagged with
+      * tag_distribute_level() already runs the threads of each rank.
+      *
+      * Only buffers allocated automatically on the host at the beginning of
+      * the function are concerned (an error is reported if the buffer is
+      * allocated with allocate_at()), and the generated code must be linked
+      * with the MPI runtime of Tiramisu.
+      */
+    void set_node_shared(bool node_shared);
+
     /**
      * Return true if all extents of the buffer are literal integer
      * contants (e.g., 4, 10, 100, ...).
@@ -2351,6 +2835,21 @@ private:
     void update_names(std::vector<std::string> original_loop_level_names, std::vector<std::string> new_names,
                       int start_erasing, int nb_loop_levels_to_erase);
 
+    /**
+      * Diamond-tile the time loop level \p levels[0] with the spatial loop
+      * level \p levels[1], and tile the other spatial loop levels with
+      * parallelograms.  \p sizes are the tile widths along the spatial
+      * loop levels.  See time_tile().
+      */
+    void time_tile(std::vector<int> levels, std::vector<int> sizes, int slope);
+
+    /**
+      * Return the set of distances (d0, d1) along the loop levels \p L0
+      * and \p L1 of the dependences of this computation on itself that
+      * are not carried by the loop levels outside \p L0.
+      */
+    isl_set *get_self_dependence_distances(int L0, int L1);
+
     /**
       * A vector describing the access variables in the original definition of  a computation.
       * For every named dimension, a pair representing the index of the named dimension
@@ -2392,8 +2891,17 @@ private:
       * Return the iteration domain of the communication set which can be either
       * a send iteration domain or a receive iteration domain.
       * set is an exchange set which we transform to a recv/send it_dom.
+      * The distributed dimension is projected out unless \p keep_distributed_dimension
+      * is true.
+      */
+    isl_set* construct_comm_set(isl_set* set, rank_t rank_type, int comm_id, bool keep_distributed_dimension = false);
+
+    /**
+      * Return true if the distributed loop of this computation is distributed
+      * with a policy other than d_rank.  The buffers of such a computation
+      * have the same layout on every rank.
       */
-    isl_set* construct_comm_set(isl_set* set, rank_t rank_type, int comm_id);
+    bool has_distribution_policy();
 
     /**
       * \brief Return an unordred_map comp_name, set_to_exchange.
@@ -2404,14 +2912,51 @@ private:
       */
     std::unordered_map<std::string, isl_set*> construct_exchange_sets();
 
+    /**
+      * \brief Return the subset of the iteration domain of this computation that
+      * reads data owned by another rank.
+      *
+      * These are the iterations that depend on the data received by the
+      * communications generated by gen_communication(), the remaining ones
+      * (the interior) can be computed while the data is being exchanged.
+      */
+    isl_set* construct_boundary_set();
+
+    /**
+      * Return the subset of the iteration domain of this computation that the
+      * rank \p rank_type executes.
+      */
+    isl_set* construct_owned_set(rank_t rank_type);
+
+    /**
+      * Return the subset of the iteration domain of the computation \p comp_name
+      * that the rank r_receiver reads to execute its part of this computation,
+      * or NULL if this computation does not read \p comp_name.
+      */
+    isl_set* construct_needed_set(const std::string &comp_name);
+
+    /**
+      * \brief Generate the communication between the rank \p root and every other rank.
+      *
+      * \p set is a subset of the iteration domain of this computation that depends on
+      * the rank \p rank_type.  If \p rank_type is r_receiver, \p root sends to each rank
+      * its part of \p set (scatter).  If it is r_sender, each rank sends its part of
+      * \p set to \p root (gather).  The received elements are stored where this
+      * computation stores them.  The xfer is not scheduled.
+      */
+    xfer gen_root_communication_code(isl_set* set, rank_t rank_type, int root);
+
     /**
       * \brief Generate distributed communication code.
       *
       * Given the iteration domain of send and receive, this function creates xfers, schedules them,
       * and handles the storage of the receives.
       * Currently, this process works for programs that distribute the outermost loop.
+      * If \p overlap is true, the xfers are posted (see communicator::set_posted())
+      * and are not scheduled, this is left to the caller.
       */
-    void gen_communication_code(isl_set*recv_it, isl_set* send_it, int communication_id, std::string computation_name);
+    xfer gen_communication_code(isl_set*recv_it, isl_set* send_it, int communication_id, std::string computation_name,
+                                bool overlap = false);
 
 protected:
 
@@ -2451,6 +2996,14 @@ protected:
       */
     isl_ast_expr *wait_index_expr;
 
+    /**
+      * Create a library call computation that completes all the posted
+      * transfers (see communicator::set_posted()) by calling
+      * tiramisu_MPI_Wait_posted().  It is executed once per point of
+      * \p iteration_domain_str.
+      */
+    static computation *create_posted_wait(std::string iteration_domain_str, tiramisu::function *fct);
+
     /**
       * Dummy constructor for derived classes.
       */
@@ -2909,6 +3462,8 @@ public:
 
     virtual bool is_wait() const;
 
+    virtual bool is_collective() const;
+
     /**
        * \brief Add a let statement that is associated to this computation.
        * \details The let statement will be executed before the computation
@@ -3378,6 +3933,132 @@ public:
                       const std::vector<expr> copy_offsets,
                       bool pad_buffer=false);
 
+    /**
+     * Copy the tile of the input computation \p inp accessed under the
+     * loop \p level into a small contiguous local buffer and access it
+     * from there.  This is the CPU counterpart of cache_shared(): it is
+     * the packing step that makes the tiles of GEMM-like kernels fit
+     * in the L1 cache and be accessed with unit stride.
+     *
+     * At each iteration of \p level, a copy loop nest reads the tile from
+     * \p inp and stores it into a buffer allocated at \p level (the buffer
+     * is private to the iteration, so outer loops can be parallelized).
+     * The innermost copy loop is vectorized.  The copy is clipped to the
+     * iteration domain of \p inp, so partial tiles at the boundaries are
+     * handled.
+     *
+     * \p level is the level after which the accesses will be cached.
+     *
+     * \p buffer_shape is the shape of the local buffer.  It should have the
+     * same dimensionality as the input computation.  If it is empty, the
+     * footprint of the accesses to \p inp within one iteration of \p level
+     * is computed and used as buffer shape.
+     *
+     * \p copy_offsets is the offset of the values that should be copied
+     * from the input computation at each iteration of \p level.  It is
+     * expressed using the names of the loop levels enclosing \p level.
+     * If it is empty, the lower bound of the footprint is used.
+     *
+     * If \p transpose is true, the two innermost dimensions of the local
+     * buffer are swapped.  This is useful when the consumer traverses
+     * \p inp column-wise.
+     *
+     * The local buffer is indexed modulo its shape, so the offsets do not
+     * need to be multiples of the shape; but the user must make sure that
+     * the accesses under \p level fit in \p buffer_shape.
+     *
+     * Returns the new access computation for input.
+     *
+     * An example use case for GEMM:
+     *
+     * \code
+     * computation C({i, j, k}, C(i, j) + A(i, k) * B(k, j));
+     * C.tile(i, j, 32, 32, i0, j0, i1, j1);
+     * C.split(k, 64, k0, k1);
+     * C.interchange(j1, k0);
+     * C.interchange(i1, k0);
+     * // Pack the 32x64 tile of A and the 64x32 tile of B.
+     * C.cache_local(A, k0);
+     * C.cache_local(B, k0, {64, 32}, {k0 * 64, j0 * 32});
+     * \endcode
+     */
+    computation *cache_local(computation &inp, const var &level,
+                             std::vector<int> buffer_shape = {},
+                             std::vector<expr> copy_offsets = {},
+                             bool transpose = false);
+
+    /**
+     * Split a reduction into partial reductions along the loop level \p L,
+     * so that \p L can be parallelized or vectorized.
+     *
+     * This computation must be a reduction written as an update (see
+     * store_in()), i.e., its expression must be of the form
+     * <tt>op(C(...), e)</tt> where C(...) reads the value being updated and
+     * \p op is o_add, o_mul, o_max or o_min.  The operator must be
+     * associative and commutative, since the order in which the values are
+     * combined changes (for floating point additions, the result may
+     * differ slightly from the sequential one).
+     *
+     * The reduction is split into three stages, scheduled one after the
+     * other at the root level in place of this computation:
+     *     - an initialization of the partial accumulators with the
+     *     identity of \p op,
+     *     - the partial reduction, which has the same domain and schedule
+     *     as this computation, but accumulates into a separate accumulator
+     *     for each iteration of \p L,
+     *     - the combination of the partial accumulators into the original
+     *     output (this computation is turned into this stage, so its
+     *     consumers are not affected).
+     *
+     * The partial accumulators are stored in a buffer that has one
+     * dimension for \p L followed by the dimensions of the output buffer.
+     * \p L is the outermost dimension so that, when \p L is parallel, each
+     * thread updates its own contiguous copy of the output instead of
+     * sharing cache lines with the other threads (the copies of outputs
+     * smaller than a cache line are padded to a cache line).  The buffer
+     * is allocated automatically.
+     *
+     * This computation must be mapped to a buffer (e.g. using store_in())
+     * and must be ordered with respect to the other computations before
+     * calling this function.
+     *
+     * Returns the partial reduction computation.  The loop levels of this
+     * computation have the same names as those of the original computation.
+     *
+     * \code
+     * computation C({i, j}, p_float32);
+     * C.set_expression(C(i, 0) + B(i, j));
+     * C.store_in({i}, {N});
+     * C.split(j, 256, j0, j1);
+     * computation *C_rf = C.rfactor(j0);
+     * C_rf->parallelize(j0);
+     * \endcode
+     */
+    computation *rfactor(tiramisu::var L);
+
+    /**
+      * Parallelize the loop level \p L of this update, even though
+      * different iterations of \p L may update the same element.
+      *
+      * \p strategy is one of the following:
+      *     - u_atomic: the updates are performed atomically (see
+      *     tag_atomic_update()).
+      *     - u_privatize: each iteration of \p L accumulates into a
+      *     private copy of the output, and the copies are merged after
+      *     the loop (see rfactor()).  \p L is usually the outer loop of
+      *     a split, so that there are about as many private copies as
+      *     threads.
+      *     - u_auto: privatize if the private copies are small and each of
+      *     their elements is updated several times (high contention),
+      *     otherwise use atomic updates.
+      *
+      * Privatization requires an affine store (see rfactor()).
+      *
+      * Returns the computation whose loop level \p L was parallelized
+      * (this computation, or the partial update if privatized).
+      */
+    computation *parallelize_update(tiramisu::var L, tiramisu::update_strategy_t strategy = tiramisu::u_auto);
+
     /**
       * This function assumes that \p consumer consumes values produced by
       * this computation (which is the producer).
@@ -3673,6 +4354,59 @@ public:
       */
     virtual void parallelize(var L);
 
+    /**
+      * Tag the loop level \p L to be parallelized and distribute its
+      * iterations over the threads using the policy \p policy:
+      *   - s_static: chunks of \p chunk_size iterations are assigned
+      *     round-robin to the threads.  If \p chunk_size is 0, each
+      *     thread gets one contiguous chunk.
+      *   - s_dynamic: the threads take the next chunk of \p chunk_size
+      *     iterations (1 if \p chunk_size is 0) when they become idle.
+      *   - s_guided: like s_dynamic, but each chunk is the number of
+      *     remaining iterations divided by the number of threads, and
+      *     is at least \p chunk_size iterations.
+      *   - s_default: same as parallelize(L).
+      *
+      * s_dynamic and s_guided balance loops whose iterations have
+      * different costs (e.g., triangular loops or sparse rows).
+      * The number of threads is read from HL_NUM_THREADS, as in the
+      * Halide runtime, or is the number of cores.
+      */
+    virtual void parallelize(var L, tiramisu::parallel_schedule_t policy, int chunk_size = 0);
+
+    /**
+      * Prefetch the elements of the buffer \p buff accessed by this
+      * computation \p distance iterations ahead of the loop level \p L.
+      *
+      * At the beginning of each iteration of \p L, a prefetch is emitted
+      * for the region of \p buff that this computation accesses in the
+      * iteration \p L + \p distance.  This is useful for bandwidth-bound
+      * loops whose accesses are not well covered by the hardware
+      * prefetcher.
+      *
+      * If \p distance is 0, the distance is computed automatically: the
+      * number of memory accesses executed by one iteration of \p L is
+      * estimated and the distance is chosen so that these accesses cover
+      * the latency of a cache miss.
+      *
+      * The loop level \p L should not be vectorized or distributed.
+      *
+      * \code
+      * computation y({i, j}, y(i) + A(i, j) * x(j));
+      * // Prefetch the row of A used 2 iterations later.
+      * y.prefetch(b_A, i, 2);
+      * \endcode
+      */
+    void prefetch(tiramisu::buffer &buff, tiramisu::var L, int distance = 0);
+
+    /**
+      * Identical to
+      *     void prefetch(tiramisu::buffer &buff, tiramisu::var L, int distance = 0);
+      * except that the prefetched buffer is the buffer where the
+      * computation \p inp is stored.
+      */
+    void prefetch(tiramisu::computation &inp, tiramisu::var L, int distance = 0);
+
     /**
        * Set the access relation of the computation.
        *
@@ -3988,6 +4722,28 @@ public:
       */
     void tag_parallel_level(int L);
 
+    /**
+      * Collapse the perfectly nested loop levels \p L0 to \p L1 (\p L0
+      * being the outer one) into a single loop, and parallelize it.
+      *
+      * The collapsed loop iterates over the product of the extents of the
+      * original loops and the original loop iterators are recovered from
+      * its iterator with divisions and modulos.  This is useful when the
+      * outer loop has a small trip count (e.g., a batch of size 1) and
+      * does not expose enough parallelism on its own.  For example
+      *
+      * \code
+      * C.collapse(c, y);
+      * \endcode
+      *
+      * executes all the (c, y) iterations of C in parallel.
+      *
+      * The extents of the loops \p L0 to \p L1 should not depend on the
+      * iterators of these loops and no other computation should be nested
+      * between them, otherwise only the loop level \p L0 is parallelized.
+      */
+    void collapse(tiramisu::var L0, tiramisu::var L1);
+
     /**
       * Tag the loop level \p L to be vectorized.
       * \p len is the vector length.
@@ -4018,6 +4774,108 @@ public:
     void tag_distribute_level(int L);
     // @}
 
+    /**
+      * Tag the loop level \p L to be distributed over \p nb_ranks ranks
+      * using the policy \p policy:
+      *   - d_block: each rank executes one contiguous block of
+      *     ceil(extent / nb_ranks) iterations.
+      *   - d_cyclic: the iteration i is executed by the rank
+      *     (i - first iteration) % nb_ranks.
+      *   - d_block_cyclic: blocks of \p block_size iterations are assigned
+      *     round-robin to the ranks.
+      *   - d_rank: same as tag_distribute_level(L).
+      *
+      * The cyclic policies balance loops whose iterations have different
+      * costs (e.g., triangular loops or sparse rows).  With these policies
+      * (and with the weighted one), the buffers of the computation have the
+      * same layout on every rank, each rank only computing its part, and
+      * gen_communication() receives the missing elements at their place.
+      */
+    void tag_distribute_level(tiramisu::var L, tiramisu::distribution_t policy, int nb_ranks,
+                              int block_size = 0);
+
+    /**
+      * Tag the loop level \p L to be distributed over weights.size() ranks,
+      * the rank r executing a contiguous block of iterations proportional
+      * to weights[r] (e.g., the capacity of its node, or the inverse of the
+      * cost of an iteration on it).  The weights should not be negative and
+      * at least one of them should be positive.
+      */
+    void tag_distribute_level(tiramisu::var L, const std::vector<int> &weights);
+
+    /**
+      * Tag the stores of this computation to be non-temporal.
+      *
+      * Non-temporal (streaming) stores write directly to memory without
+      * going through the cache.  This avoids reading the destination
+      * cache lines before writing them (read-for-ownership) and evicting
+      * useful data from the cache.  It is only beneficial for large
+      * outputs that are written once and not read again soon.  Only the
+      * stores of this computation are affected: other computations that
+      * store into the same buffer keep regular stores.
+      *
+      * A fence is inserted at the end of the generated function (and at
+      * the end of each parallel task) so that the stores are visible when
+      * the function returns.
+      *
+      * The innermost loop should be vectorized and the vector stores
+      * should be aligned, since the hardware only provides aligned
+      * non-temporal vector stores.
+      */
+    void tag_nontemporal_store();
+
+    /**
+      * Tag this update to be performed with atomic read-modify-write
+      * operations when one of its loop levels is parallelized.
+      *
+      * This computation must be an update of the form
+      * <tt>C(...) = op(C(...), e)</tt> where both accesses to C refer
+      * to the same element and \p op is o_add, o_mul, o_max or o_min.
+      * This makes scatters (e.g. histograms) safe to parallelize even when
+      * different iterations update the same element.  Integer additions
+      * are performed with a single atomic instruction, the other updates
+      * with a compare-and-swap loop.
+      *
+      * The loop levels of this computation should not be vectorized.
+      *
+      * \code
+      * computation H_init({k}, expr((int32_t) 0));
+      * computation H({i}, H_init(i % 16) + A(i));
+      * H_init.store_in(&b_hist, {k});
+      * H.store_in(&b_hist, {i % 16});
+      * H.after(H_init, computation::root);
+      * H.tag_atomic_update();
+      * H.parallelize(i);
+      * \endcode
+      */
+    void tag_atomic_update();
+
+    /**
+      * Allow this computation to be executed as a task, concurrently with
+      * the other computations tagged with this command.
+      *
+      * Consecutive loop nests (in the order defined by then(), after(),
+      * ...) that only contain tagged computations and that do not depend
+      * on each other are executed concurrently: each loop nest is a task
+      * and the tasks are executed by the threads of the runtime.  Two loop
+      * nests depend on each other if one of them writes a buffer accessed
+      * by the other, so dependent loop nests are still executed in order.
+      * A task can itself contain parallel loops.
+      *
+      * For example, the two independent branches
+      *
+      * \code
+      * B1.after(A, computation::root);
+      * B2.after(B1, computation::root);
+      * C.after(B2, computation::root);
+      * B1.tag_task_parallel();
+      * B2.tag_task_parallel();
+      * \endcode
+      *
+      * are executed concurrently after A and before C.
+      */
+    void tag_task_parallel();
+
     /**
       * Tag the loop level \p L to be unrolled.
       *
@@ -4105,6 +4963,105 @@ public:
     virtual void tile(int L0, int L1, int L2, int sizeX, int sizeY, int sizeZ);
     // @}
 
+    /**
+      * Tile the time loop \p t and the spatial loop \p i of an iterative
+      * stencil with diamond tiles, so that the tiles can be executed in
+      * parallel.
+      *
+      * Skewing the spatial loop by the time loop and tiling them
+      * (parallelogram tiling) exposes temporal locality but serializes the
+      * tiles along the space dimension.  Diamond tiling cuts the (t, i)
+      * space along the hyperplanes slope*t + i and slope*t - i instead:
+      * all the tiles of a row of diamonds start at the same time step
+      * (concurrent start) and are independent from each other.
+      *
+      * \p size is the width of the diamonds along the spatial dimension.
+      * \p slope is the largest distance along \p i of a dependence
+      * between two consecutive time steps (1 for a 3-point stencil).
+      *
+      * After tiling, the loop nest is (T, P, t1, i1) where T iterates
+      * over the rows of diamonds, P over the diamonds of a row (it is
+      * parallelized by this function) and t1, i1 over the points of a
+      * diamond (t1 and i1 are the original t and i).
+      *
+      * The overload with a second spatial loop \p j implements hybrid
+      * tiling: (t, i) are tiled with diamonds and \p j, skewed by the
+      * time loop, is tiled with parallelograms of width \p sizeY.  The
+      * loop nest is then (T, P, J, t1, i1, j1).
+      *
+      * \p t, \p i (and \p j) should be consecutive loop levels.  The
+      * legality of the transformation is not checked: the values of the
+      * stencil at time t should only depend on the values at time t - 1
+      * within a distance of \p slope, and should not be stored in the
+      * same buffer elements as the values of the time steps t - 2, t - 3,
+      * ... that other tiles may still need.
+      *
+      * \code
+      * // for (t = 1; t < T; t++)
+      * //   for (i = 1; i < N - 1; i++)
+      * //     A(t, i) = (A(t - 1, i - 1) + A(t - 1, i) + A(t - 1, i + 1)) / 3;
+      * A.time_tile(t, i, 32, T0, P0, t1, i1);
+      * \endcode
+      */
+    // @{
+    virtual void time_tile(var t, var i, int size, var T, var P, var t1, var i1, int slope = 1);
+    virtual void time_tile(var t, var i, var j, int size, int sizeY, var T, var P, var J,
+                           var t1, var i1, var j1, int slope = 1);
+    // @}
+
+    /**
+      * \overload
+      */
+    // @{
+    virtual void time_tile(int t, int i, int size, int slope = 1);
+    virtual void time_tile(int t, int i, int j, int size, int sizeY, int slope = 1);
+    // @}
+
+    /**
+      * Parallelize the loop nest (\p L0, \p L1), whose dependences are
+      * carried by both loop levels (e.g., a recursive filter or a
+      * triangular solve), by executing it as a sequence of wavefronts.
+      *
+      * The dependences of this computation on itself are analyzed to find
+      * the smallest factor f such that skewing \p L1 by f * \p L0 makes
+      * all the dependences carried by the skewed loop.  The loop levels
+      * are then skewed and interchanged: the outer loop \p W iterates over
+      * the wavefronts and the inner loop \p P over the (independent)
+      * iterations of a wavefront, and \p P is parallelized.
+      *
+      * \p L0 and \p L1 should be consecutive loop levels.
+      *
+      * \code
+      * // A(i, j) = A(i - 1, j) + A(i, j - 1)
+      * A.wavefront(i, j, w, p);
+      * \endcode
+      */
+    // @{
+    void wavefront(tiramisu::var L0, tiramisu::var L1, tiramisu::var W, tiramisu::var P);
+    void wavefront(tiramisu::var L0, tiramisu::var L1);
+    // @}
+
+    /**
+      * Parallelize the loop level \p L0 of the loop nest (\p L0, \p L1),
+      * whose dependences are carried by both loop levels, using point to
+      * point synchronization instead of barriers.
+      *
+      * The iterations of \p L0 run in parallel and the iterations of
+      * \p L1 in each of them wait until the iterations of \p L1 they
+      * depend on are done in the previous iterations of \p L0.  The
+      * synchronization distances are computed from the dependences of this
+      * computation on itself.  Compared to wavefront(), the loop order
+      * (and thus the locality) is preserved and there is no barrier
+      * between wavefronts, but the iterations of \p L1 are synchronized
+      * through memory flags, so their granularity should be large enough
+      * (e.g., split \p L1 and use its outer loop).
+      *
+      * The dependences along \p L0 should have a bounded distance.
+      * \p L0 and \p L1 should be consecutive loop levels and this
+      * computation should be alone in the loop \p L0.
+      */
+    void wavefront_pipeline(tiramisu::var L0, tiramisu::var L1);
+
     /**
       * Unroll the loop level \p L with an unrolling factor \p fac.
       *
@@ -4171,6 +5128,68 @@ public:
     virtual void unroll(var L, int fac, var L_outer, var L_inner);
     //@}
 
+    /**
+      * Unroll the loop level \p L by \p factor and jam the copies of the
+      * loop body into the innermost loop.
+      *
+      * This is the register blocking of GEMM-like kernels.  For example,
+      * with C(i, j) += A(i, k) * B(k, j) and the loop order (i, j, k),
+      * C.unroll_and_jam(j, 4) generates
+      *
+      * \code
+      * for (int i = 0; i < N; i++)
+      *   for (int j1 = 0; j1 < N/4; j1++)
+      *     for (int k = 0; k < N; k++)
+      *     {
+      *       C[i][4*j1 + 0] += A[i][k] * B[k][4*j1 + 0];
+      *       ...
+      *       C[i][4*j1 + 3] += A[i][k] * B[k][4*j1 + 3];
+      *     }
+      * for (int i = 0; i < N; i++)
+      *   for (int j = 4*(N/4); j < N; j++)
+      *     ... // remainder, not unrolled
+      * \endcode
+      *
+      * The accumulators of the innermost loop (the elements that are
+      * updated at an address that does not depend on the innermost loop,
+      * C[i][4*j1 + 0..3] above) are scalar replaced: they are loaded into
+      * registers before the innermost loop and stored after it.
+      *
+      * If \p L is parallel, the unrolled loop and the remainder loop are
+      * both parallel, and both use the policy given to parallelize().
+      *
+      * The loops nested in \p L should be perfectly nested and their
+      * bounds should not depend on \p L, otherwise \p L is left as is.
+      * The legality of the transformation is not checked.
+      */
+    void unroll_and_jam(tiramisu::var L, int factor);
+
+    /**
+      * Promote the buffer accesses that are invariant in the loop level
+      * \p L to registers (scalar replacement).
+      *
+      * The elements accessed at an index that does not depend on \p L
+      * (or on the loops nested in it) are loaded into registers once
+      * before the loop \p L, the loop accesses the registers, and the
+      * elements that are stored in the loop are stored back once after
+      * it.  Vector accesses are promoted to vector registers.  For
+      * example, with C(i, j) += A(i, k) * B(k, j) and the loop order
+      * (i, j, k),
+      *
+      * \code
+      * C.promote_to_register(k);
+      * \endcode
+      *
+      * keeps C(i, j) in a register during the k loop.
+      *
+      * A buffer is only promoted if all its accesses in the loop are
+      * executed unconditionally and access the promoted elements, and if
+      * the promoted elements of the buffer are a constant distance apart
+      * and do not overlap (e.g., C(i, j) and C(i, j + 1), but not C(i, j)
+      * and C(j, i)), so that the registers cannot be aliased.
+      */
+    void promote_to_register(tiramisu::var L);
+
     /**
       * Vectorize the loop level \p L.  Use the vector length \p v.
       *
@@ -4239,6 +5258,34 @@ public:
     virtual void vectorize(var L, int v, var L_outer, var L_inner);
     // @}
 
+    /**
+      * Vectorize the loop level \p L with a vector length \p v, and
+      * execute the iterations that do not fill a whole vector using the
+      * mode \p tail:
+      *   - v_epilogue: in a separate scalar loop (same as vectorize(L, v)).
+      *   - v_masked: in a last vector iteration whose loads and stores
+      *     are masked (predicated), so the lanes past the end of the loop
+      *     do not access memory.  The loop is only split (not separated),
+      *     so no scalar copy of the loop body is generated.  This mode
+      *     also vectorizes the loops that have less than \p v iterations
+      *     (e.g., small channel dimensions).
+      *   - v_padded: in a last full vector iteration.  The lanes past the
+      *     end of the loop are computed and stored in a padding that
+      *     function::codegen() adds to the buffers accessed by the loop
+      *     (see pad_buffers_for_vector_tails()); the results computed in
+      *     the padding are ignored.  Input and output buffers are padded
+      *     only if set_automatic_buffer_padding(true, true) is called (an
+      *     error is reported otherwise).
+      *
+      * A masked loop body that contains loops, allocations or calls is
+      * executed under a condition instead (it is then not vectorized by
+      * Halide).
+      */
+    // @{
+    virtual void vectorize(var L, int v, tiramisu::vector_tail_t tail);
+    virtual void vectorize(var L, int v, tiramisu::vector_tail_t tail, var L_outer, var L_inner);
+    // @}
+
     /**
       * \brief Generate communication code for this computation
       *
@@ -4246,8 +5293,20 @@ public:
       * xfers, schedule the send, receive at root level if no computation was scheduled before,
       * map the received data to correct locations and allocate the required extra memory.
       *
+      * If \p overlap is true, the communications are overlapped with the computation:
+      * the sends and the receives are posted without waiting for them to complete,
+      * then the interior of the computation (the iterations that do not read received
+      * data) is computed, then the communications are completed and the boundary of
+      * the computation (the remaining iterations) is computed. The boundary is a new
+      * definition of this computation.
+      *
+      * The generated xfers transfer one element per iteration; they are not
+      * collapsed and do not use MPI derived datatypes, even when the region
+      * exchanged is strided.  To send a strided region (e.g., a column halo)
+      * as a single message, write the xfer with create_xfer() and use
+      * communicator::collapse_strided().
       */
-    void gen_communication();
+    void gen_communication(bool overlap = false);
 
     /**
       * Same as gen_communication(), but schedules send/recv at level l.
@@ -4380,6 +5439,20 @@ public:
 
     static xfer create_xfer(std::string iter_domain, xfer_prop prop, tiramisu::expr expr,
                             tiramisu::function *fct);
+
+    /**
+      * Create a one-sided MPI transfer (\p prop must contain MPI and either RMA_PUT or
+      * RMA_GET). The transfer is a single computation executed by the origin rank only:
+      * with RMA_PUT, \p expr is read locally and written into the buffer of the rank
+      * \p peer; with RMA_GET, \p expr is read from the buffer of the rank \p peer and
+      * written locally. In both cases the local and remote elements are located by the
+      * access of the transfer, i.e. the exchanged buffer must have the same layout on
+      * every rank.
+      * The buffers accessed by one-sided transfers are exposed as MPI windows, and the
+      * transfers are enclosed in fence epochs, during code generation.
+      */
+    static xfer create_xfer(std::string iter_domain, tiramisu::expr peer, xfer_prop prop,
+                            tiramisu::expr expr, tiramisu::function *fct);
 };
 
 class input: public computation
@@ -4801,6 +5874,20 @@ protected:
                                                             std::vector<std::pair<std::string, std::string>> &tagged_stmts,
                                                             bool is_a_child_block);
 
+    /**
+      * Execute the statements \p tasks concurrently, as the iterations of
+      * a parallel loop.
+      */
+    static Halide::Internal::Stmt make_task_parallel_block(const std::vector<Halide::Internal::Stmt> &tasks);
+
+    /**
+      * Collect the buffers read (\p reads) and written (\p writes) by the
+      * computations of the ISL AST \p node.  Return false if \p node
+      * contains a computation that cannot be executed as a task.
+      */
+    static bool get_task_accesses(const tiramisu::function &fct, isl_ast_node *node,
+                                  std::set<std::string> &reads, std::set<std::string> &writes);
+
     // TODO doc
     static Halide::Internal::Stmt make_halide_block(const Halide::Internal::Stmt &first,
             const Halide::Internal::Stmt &second);
@@ -4809,6 +5896,137 @@ protected:
                                                     Halide::Internal::Stmt &stmt);
     static Halide::Internal::Stmt make_buffer_free(buffer *b);
 
+    /**
+      * Return a statement that touches the host buffer \p b (whose
+      * extents are \p extents, from innermost to outermost) once per page,
+      * in parallel over its outermost dimension.
+      */
+    static Halide::Internal::Stmt make_buffer_first_touch(buffer *b, const std::vector<Halide::Expr> &extents);
+
+    /**
+      * Insert at the beginning of \p body (the body of the loop with the
+      * iterator \p iterator) prefetches for the accesses to the buffer
+      * \p buffer_name that happen \p distance iterations later.
+      * If \p distance is 0, it is computed from an estimate of the number
+      * of memory accesses in \p body.
+      */
+    static Halide::Internal::Stmt make_prefetch(const std::string &buffer_name,
+                                                const std::string &iterator, int distance,
+                                                const Halide::Internal::Stmt &body);
+
+    /**
+      * Turn the store \p s, an update of the form
+      * <tt>b[i] = op(b[i], e)</tt>, into an atomic read-modify-write of
+      * b[i] (a call to the runtime function tiramisu_atomic_<op>_<type>).
+      * \p type is the type of the elements of b.
+      */
+    static Halide::Internal::Stmt make_atomic_update(const Halide::Internal::Stmt &s, tiramisu::primitive_t type);
+
+    /**
+      * Synchronize the iterations of the parallel loop \p loop point to
+      * point instead of running its inner loops as barrier separated
+      * wavefronts.  Each iteration i of \p loop publishes the last
+      * iteration j done by the inner loops that store into the buffer
+      * \p buffer_name, and for each pair (k, lag) of \p lags, waits before
+      * its iteration j until the iteration i - k has done j + lag.
+      */
+    static Halide::Internal::Stmt make_wavefront_pipeline(const Halide::Internal::Stmt &loop,
+                                                          const std::string &buffer_name,
+                                                          const std::vector<std::pair<int, int>> &lags);
+
+    /**
+      * Collapse \p loop and the \p n - 1 loops perfectly nested in it into
+      * a single loop that has the type of \p loop.  \p loop is returned
+      * unchanged if the loops are not perfectly nested, if an inner loop
+      * is not serial or if its bounds depend on an outer collapsed loop.
+      */
+    static Halide::Internal::Stmt make_collapsed_loop(const Halide::Internal::Stmt &loop, int n);
+
+    /**
+      * Unroll \p loop by \p factor and jam the copies of its body into the
+      * innermost loop nested in it, then scalar replace the accumulators
+      * of that loop (see computation::unroll_and_jam()).  \p loop is
+      * returned unchanged if the loops nested in it are not perfectly
+      * nested or if their bounds depend on the iterator of \p loop.
+      */
+    static Halide::Internal::Stmt make_unroll_and_jam(const Halide::Internal::Stmt &loop, int factor);
+
+    /**
+      * Promote the accesses that are invariant in \p loop to registers
+      * (see computation::promote_to_register()).
+      */
+    static Halide::Internal::Stmt make_register_promotion(const Halide::Internal::Stmt &loop);
+
+    /**
+      * Predicate the loads and the stores of the body \p body of a
+      * vectorized loop with \p mask, so that they can be vectorized as
+      * masked loads and stores.  If \p body cannot be predicated, it is
+      * executed under the condition \p mask instead.
+      */
+    static Halide::Internal::Stmt make_masked_vector_body(const Halide::Internal::Stmt &body,
+                                                          const Halide::Expr &mask);
+
+    /**
+      * Replace the loops of \p s that wait on consecutive elements of a
+      * request buffer with a single call to tiramisu_MPI_Waitall.
+      */
+    static Halide::Internal::Stmt make_batched_waits(const Halide::Internal::Stmt &s);
+
+    /**
+      * Call tiramisu_MPI_Testsome on the requests of each
+      * tiramisu_MPI_Waitall of \p s at the beginning of the iterations of
+      * the loops that run between the nonblocking transfers that post
+      * these requests and the wait.
+      */
+    static Halide::Internal::Stmt make_request_tests(const Halide::Internal::Stmt &s);
+
+    /**
+      * Aggregate the small blocking MPI sends of \p s to the same peer.  The
+      * sends of a communication phase (a sequential loop nest that only
+      * sends messages) that are repeated to the same peer with the same tag
+      * are appended to a single message, sent when the phase ends, and the
+      * matching receives read their elements from that message.
+      */
+    static Halide::Internal::Stmt make_message_aggregation(const Halide::Internal::Stmt &s);
+
+    /**
+      * Hoist the blocking MPI transfers of \p s whose arguments do not
+      * change across the iterations of a loop out of that loop, as
+      * persistent requests.  Each run of consecutive transfers in the loop
+      * body is replaced with MPI_Startall and MPI_Waitall on its requests.
+      * This pass is only applied to the functions that enable it with
+      * function::set_persistent_communication().
+      */
+    static Halide::Internal::Stmt make_persistent_communication(const Halide::Internal::Stmt &s);
+
+    /**
+      * Expose the buffers accessed by the one-sided MPI transfers of \p s
+      * (the function \p fct) as MPI windows, and enclose these transfers in
+      * fence epochs.
+      */
+    static Halide::Internal::Stmt make_rma_epochs(const tiramisu::function &fct, const Halide::Internal::Stmt &s);
+
+    /**
+      * Distribute the iterations of the parallel loop \p loop over the
+      * threads using the policy \p policy and chunks of \p chunk_size
+      * iterations (see computation::parallelize()).  If \p loop was
+      * replaced with several loops (e.g., by unroll and jam), each of its
+      * outermost parallel loops is distributed.
+      */
+    static Halide::Internal::Stmt make_parallel_schedule(const Halide::Internal::Stmt &loop,
+                                                         tiramisu::parallel_schedule_t policy,
+                                                         int chunk_size);
+
+    /**
+      * Restrict the distributed loop \p loop to the iterations of the
+      * current rank under the policy \p policy, with blocks of \p block_size
+      * iterations and the weights \p weights of the ranks (see
+      * computation::tag_distribute_level()).
+      */
+    static Halide::Internal::Stmt make_distributed_loop(const Halide::Internal::Stmt &loop,
+                                                        tiramisu::distribution_t policy, int block_size,
+                                                        const std::vector<int> &weights);
+
     /**
      * Create a Halide expression from a  Tiramisu expression.
      */
@@ -4984,6 +6202,19 @@ private:
 
     std::vector<tiramisu::expr> dims;
 
+    /**
+      * If the communicator transfers a strided region, the number of
+      * contiguous blocks and the distance (in elements) between the
+      * beginnings of two consecutive blocks.
+      */
+    tiramisu::expr block_count;
+    tiramisu::expr block_stride;
+
+    /**
+      * True if the communicator is posted (see set_posted()).
+      */
+    bool posted = false;
+
 protected:
 
     xfer_prop prop;
@@ -5016,6 +6247,45 @@ public:
       */
     void collapse_many(std::vector<collapse_group> collapse_each);
 
+    /**
+      * Collapse the loop level \p level, whose \p num_collapsed iterations
+      * transfer blocks that are \p stride elements apart in the buffer
+      * (e.g., the rows of a column halo).  The block transferred by one
+      * iteration is described by the loop levels collapsed with collapse()
+      * (a single element if there are none).
+      *
+      * The whole strided region is then transferred by a single message,
+      * either directly from the buffer using an MPI vector datatype or,
+      * for small blocks, through a packed copy.  Only one loop level can be
+      * collapsed this way, and only blocking transfers are supported.
+      */
+    void collapse_strided(int level, tiramisu::expr collapse_from_iter, tiramisu::expr num_collapsed,
+                          tiramisu::expr stride);
+
+    /**
+      * Return true if the communicator transfers a strided region (see
+      * collapse_strided()).
+      */
+    bool is_strided() const;
+
+    tiramisu::expr get_block_count() const;
+
+    tiramisu::expr get_block_stride() const;
+
+    /**
+      * Post this blocking transfer without waiting for it to complete.  The
+      * request of the transfer is kept by the runtime, and all the posted
+      * transfers are completed by a call to tiramisu_MPI_Wait_posted().
+      * This is used to overlap the communications generated by
+      * gen_communication() with the computation.
+      */
+    void set_posted();
+
+    /**
+      * Return true if the communicator is posted (see set_posted()).
+      */
+    bool is_posted() const;
+
 };
 
 class send : public communicator {
@@ -5105,6 +6375,13 @@ public:
 };
 
 class send_recv : public communicator {
+private:
+
+    /**
+      * The rank targeted by a one-sided MPI transfer.
+      */
+    tiramisu::expr peer;
+
 public:
 
     send_recv(std::string iteration_domain_str, tiramisu::computation *producer,
@@ -5113,6 +6390,10 @@ public:
 
     virtual bool is_send_recv() const override;
 
+    tiramisu::expr get_peer() const;
+
+    void set_peer(tiramisu::expr peer);
+
 };
 
 class wait : public communicator {
@@ -5137,6 +6418,78 @@ public:
 
 };
 
+/**
+  * A collective operation, executed by all the ranks (a collective must not
+  * be distributed).  Each rank contributes the \p count elements that start
+  * at the access \p rhs, and the result is stored at the access of the
+  * collective (set with set_access(), as for any computation):
+  *  - ALLREDUCE: the reduction of the contributions of all the ranks
+  *    (\p count elements).
+  *  - BROADCAST: the contribution of the rank \p root (\p count elements).
+  *  - ALLGATHER: the contributions of all the ranks, in the order of the
+  *    ranks (\p count elements per rank).
+  *  - REDUCE_SCATTER: the reduction of the contributions of all the ranks
+  *    is split in blocks of count/number_of_ranks elements, rank r gets
+  *    the r-th block.  \p count must be a multiple of the number of ranks,
+  *    otherwise the collective reports an error at run time.
+  *
+  * Collectives with the NONBLOCK attribute are posted, they are completed
+  * by the computation returned by get_wait(), which has to be scheduled
+  * after the collective (and before the computations that use its result).
+  *
+  * For example, the dot product of two vectors distributed across the ranks:
+  * \code
+  * computation dot_local("{dot_local[r]: 0<=r<R}", ...);
+  * dot_local.tag_distribute_level(r);
+  * collective dot("{dot[0]}", ALLREDUCE, REDUCE_SUM, dot_local(0), 1,
+  *                xfer_prop(p_float64, {MPI, BLOCK}), &f);
+  * dot.set_access("{dot[0]->b_dot[0]}");
+  * dot.after(dot_local, computation::root);
+  * \endcode
+  */
+class collective : public communicator {
+private:
+
+    tiramisu::collective_t op;
+
+    tiramisu::reduction_t reduction;
+
+    tiramisu::expr root;
+
+    tiramisu::computation *wait_comp = nullptr;
+
+    void init_collective(std::string iteration_domain_str, tiramisu::function *fct);
+
+public:
+
+    /**
+      * Create an ALLREDUCE or a REDUCE_SCATTER.
+      */
+    collective(std::string iteration_domain_str, tiramisu::collective_t op, tiramisu::reduction_t reduction,
+               tiramisu::expr rhs, tiramisu::expr count, xfer_prop prop, tiramisu::function *fct);
+
+    /**
+      * Create a BROADCAST from the rank \p root, or an ALLGATHER (\p root
+      * is then ignored).
+      */
+    collective(std::string iteration_domain_str, tiramisu::collective_t op, tiramisu::expr rhs,
+               tiramisu::expr count, tiramisu::expr root, xfer_prop prop, tiramisu::function *fct);
+
+    virtual bool is_collective() const override;
+
+    tiramisu::collective_t get_collective_type() const;
+
+    tiramisu::reduction_t get_reduction() const;
+
+    tiramisu::expr get_root() const;
+
+    /**
+      * Return the computation that completes a nonblocking collective.
+      */
+    tiramisu::computation &get_wait() const;
+
+};
+
 // Halide IR specific functions
 
 void halide_stmt_dump(Halide::Internal::Stmt s);
@@ -5148,6 +6501,23 @@ Halide::Module lower_halide_pipeline(
     const Halide::Internal::LoweredFunc::LinkageType linkage_type,
     Halide::Internal::Stmt s);
 
+/**
+  * Return the name of the pure extern function whose calls mark the
+  * non-temporal stores.  The index of each store of a computation tagged
+  * with tag_nontemporal_store() is offset by 64 times the result of the
+  * marker, which is replaced with 0 once the stores are marked.
+  */
+std::string nontemporal_store_marker();
+
+/**
+  * Compile the Halide module \p m into the object file \p obj_file_name
+  * and make the stores whose address depends on the non-temporal store
+  * marker non-temporal.
+  */
+void compile_halide_module_with_nontemporal_stores(
+    const Halide::Module &m,
+    const std::string &obj_file_name);
+
 int loop_level_into_dynamic_dimension(int level);
 int loop_level_into_static_dimension(int level);
 /**
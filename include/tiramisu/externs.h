@@ -25,6 +25,64 @@ float *tiramisu_address_of_float32(halide_buffer_t *buffer, unsigned long index)
 
 double *tiramisu_address_of_float64(halide_buffer_t *buffer, unsigned long index);
 
+/**
+  * Advise the system to back the buffer [ptr, ptr + size) with huge pages.
+  * The advice is ignored on systems that do not support it.
+  */
+int tiramisu_madvise_huge_pages(void *ptr, uint64_t size);
+
+/**
+  * Atomic read-modify-write updates of buf[index]:
+  * tiramisu_atomic_<op>_<type>(buf, index, value) atomically performs
+  * buf[index] = op(buf[index], value), where op is add, mul, max or min
+  * and type is one of the primitive types (int8, ..., float64).  The
+  * index is 64-bit so that it holds the index of any loop iterator type
+  * (see global::set_loop_iterator_type()).
+  */
+#define TIRAMISU_DECLARE_ATOMIC_UPDATES(SUFFIX, T)                        \
+int tiramisu_atomic_add_##SUFFIX(T *buf, int64_t index, T value);         \
+int tiramisu_atomic_mul_##SUFFIX(T *buf, int64_t index, T value);         \
+int tiramisu_atomic_max_##SUFFIX(T *buf, int64_t index, T value);         \
+int tiramisu_atomic_min_##SUFFIX(T *buf, int64_t index, T value);
+
+TIRAMISU_DECLARE_ATOMIC_UPDATES(int8, int8_t)
+TIRAMISU_DECLARE_ATOMIC_UPDATES(int16, int16_t)
+TIRAMISU_DECLARE_ATOMIC_UPDATES(int32, int32_t)
+TIRAMISU_DECLARE_ATOMIC_UPDATES(int64, int64_t)
+TIRAMISU_DECLARE_ATOMIC_UPDATES(uint8, uint8_t)
+TIRAMISU_DECLARE_ATOMIC_UPDATES(uint16, uint16_t)
+TIRAMISU_DECLARE_ATOMIC_UPDATES(uint32, uint32_t)
+TIRAMISU_DECLARE_ATOMIC_UPDATES(uint64, uint64_t)
+TIRAMISU_DECLARE_ATOMIC_UPDATES(float32, float)
+TIRAMISU_DECLARE_ATOMIC_UPDATES(float64, double)
+
+/**
+  * Synchronization of the rows of a pipelined wavefront.  flags[row] is
+  * the last column of \p row that is done.
+  * tiramisu_wavefront_wait() spins until flags[row] >= column and
+  * tiramisu_wavefront_signal() publishes flags[row] = column.
+  */
+int tiramisu_wavefront_wait(int32_t *flags, int32_t row, int32_t column);
+int tiramisu_wavefront_signal(int32_t *flags, int32_t row, int32_t column);
+
+/**
+  * The number of threads used by parallel loops: HL_NUM_THREADS if it is
+  * set (as in the Halide runtime), otherwise the number of cores.
+  */
+int tiramisu_parallel_num_threads();
+
+/**
+  * Guided distribution of a loop of \p extent iterations over \p threads
+  * threads: the size of a chunk is the number of remaining iterations
+  * divided by the number of threads, or at least \p min_chunk.
+  * tiramisu_guided_chunk_next() takes the next chunk from the shared
+  * \p cursor (the first iteration that is not taken yet) and returns its
+  * first iteration.  tiramisu_guided_chunk_count() returns the number of
+  * chunks.
+  */
+int tiramisu_guided_chunk_next(int32_t *cursor, int32_t extent, int32_t threads, int32_t min_chunk);
+int tiramisu_guided_chunk_count(int32_t extent, int32_t threads, int32_t min_chunk);
+
 #ifdef WITH_MPI
 void *tiramisu_address_of_wait(halide_buffer_t *buffer, unsigned long index);
 #endif
@@ -16,6 +16,24 @@ int tiramisu_MPI_Comm_rank(int offset);
 
 void tiramisu_MPI_Wait(void *request);
 
+/**
+  * The requests of the nonblocking operations come from a pool.  Make sure
+  * that the pool has at least \p count free requests.
+  */
+int tiramisu_MPI_request_pool_reserve(int count);
+
+/**
+  * Wait for the requests stored in the \p count request slots \p requests
+  * and release them to the pool.  Empty (NULL) slots are ignored.
+  */
+int tiramisu_MPI_Waitall(int count, void **requests);
+
+/**
+  * Release the requests of \p requests that have completed and clear their
+  * slots.  Return the number of completed requests.
+  */
+int tiramisu_MPI_Testsome(int count, void **requests);
+
 void tiramisu_MPI_Send(int count, int dest, int tag, char *data, MPI_Datatype type);
 void tiramisu_MPI_Send_int8(int count, int dest, int tag, char *data);
 void tiramisu_MPI_Send_int16(int count, int dest, int tag, short *data);
@@ -88,6 +106,391 @@ void tiramisu_MPI_Irecv_uint64(int count, int source, int tag, unsigned long *st
 void tiramisu_MPI_Irecv_f32(int count, int source, int tag, float *store_in, long *reqs);
 void tiramisu_MPI_Irecv_f64(int count, int source, int tag, double *store_in, long *reqs);
 
+/**
+  * Strided transfers: \p blocks blocks of \p block_length elements, the
+  * beginnings of two consecutive blocks being \p stride elements apart.
+  */
+void tiramisu_MPI_Send_vector_int8(int blocks, int block_length, int stride, int dest, int tag, char *data);
+void tiramisu_MPI_Send_vector_int16(int blocks, int block_length, int stride, int dest, int tag, short *data);
+void tiramisu_MPI_Send_vector_int32(int blocks, int block_length, int stride, int dest, int tag, int *data);
+void tiramisu_MPI_Send_vector_int64(int blocks, int block_length, int stride, int dest, int tag, long *data);
+void tiramisu_MPI_Send_vector_uint8(int blocks, int block_length, int stride, int dest, int tag, unsigned char *data);
+void tiramisu_MPI_Send_vector_uint16(int blocks, int block_length, int stride, int dest, int tag, unsigned short *data);
+void tiramisu_MPI_Send_vector_uint32(int blocks, int block_length, int stride, int dest, int tag, unsigned int *data);
+void tiramisu_MPI_Send_vector_uint64(int blocks, int block_length, int stride, int dest, int tag, unsigned long *data);
+void tiramisu_MPI_Send_vector_f32(int blocks, int block_length, int stride, int dest, int tag, float *data);
+void tiramisu_MPI_Send_vector_f64(int blocks, int block_length, int stride, int dest, int tag, double *data);
+
+void tiramisu_MPI_Ssend_vector_int8(int blocks, int block_length, int stride, int dest, int tag, char *data);
+void tiramisu_MPI_Ssend_vector_int16(int blocks, int block_length, int stride, int dest, int tag, short *data);
+void tiramisu_MPI_Ssend_vector_int32(int blocks, int block_length, int stride, int dest, int tag, int *data);
+void tiramisu_MPI_Ssend_vector_int64(int blocks, int block_length, int stride, int dest, int tag, long *data);
+void tiramisu_MPI_Ssend_vector_uint8(int blocks, int block_length, int stride, int dest, int tag, unsigned char *data);
+void tiramisu_MPI_Ssend_vector_uint16(int blocks, int block_length, int stride, int dest, int tag, unsigned short *data);
+void tiramisu_MPI_Ssend_vector_uint32(int blocks, int block_length, int stride, int dest, int tag, unsigned int *data);
+void tiramisu_MPI_Ssend_vector_uint64(int blocks, int block_length, int stride, int dest, int tag, unsigned long *data);
+void tiramisu_MPI_Ssend_vector_f32(int blocks, int block_length, int stride, int dest, int tag, float *data);
+void tiramisu_MPI_Ssend_vector_f64(int blocks, int block_length, int stride, int dest, int tag, double *data);
+
+void tiramisu_MPI_Recv_vector_int8(int blocks, int block_length, int stride, int source, int tag, char *store_in);
+void tiramisu_MPI_Recv_vector_int16(int blocks, int block_length, int stride, int source, int tag, short *store_in);
+void tiramisu_MPI_Recv_vector_int32(int blocks, int block_length, int stride, int source, int tag, int *store_in);
+void tiramisu_MPI_Recv_vector_int64(int blocks, int block_length, int stride, int source, int tag, long *store_in);
+void tiramisu_MPI_Recv_vector_uint8(int blocks, int block_length, int stride, int source, int tag, unsigned char *store_in);
+void tiramisu_MPI_Recv_vector_uint16(int blocks, int block_length, int stride, int source, int tag, unsigned short *store_in);
+void tiramisu_MPI_Recv_vector_uint32(int blocks, int block_length, int stride, int source, int tag, unsigned int *store_in);
+void tiramisu_MPI_Recv_vector_uint64(int blocks, int block_length, int stride, int source, int tag, unsigned long *store_in);
+void tiramisu_MPI_Recv_vector_f32(int blocks, int block_length, int stride, int source, int tag, float *store_in);
+void tiramisu_MPI_Recv_vector_f64(int blocks, int block_length, int stride, int source, int tag, double *store_in);
+
+/**
+  * Posted transfers: nonblocking transfers whose requests are kept by the
+  * runtime.  tiramisu_MPI_Wait_posted() completes all the posted transfers.
+  */
+void tiramisu_MPI_Wait_posted();
+
+void tiramisu_MPI_Isend_posted_int8(int count, int dest, int tag, char *data);
+void tiramisu_MPI_Isend_posted_int16(int count, int dest, int tag, short *data);
+void tiramisu_MPI_Isend_posted_int32(int count, int dest, int tag, int *data);
+void tiramisu_MPI_Isend_posted_int64(int count, int dest, int tag, long *data);
+void tiramisu_MPI_Isend_posted_uint8(int count, int dest, int tag, unsigned char *data);
+void tiramisu_MPI_Isend_posted_uint16(int count, int dest, int tag, unsigned short *data);
+void tiramisu_MPI_Isend_posted_uint32(int count, int dest, int tag, unsigned int *data);
+void tiramisu_MPI_Isend_posted_uint64(int count, int dest, int tag, unsigned long *data);
+void tiramisu_MPI_Isend_posted_f32(int count, int dest, int tag, float *data);
+void tiramisu_MPI_Isend_posted_f64(int count, int dest, int tag, double *data);
+
+void tiramisu_MPI_Issend_posted_int8(int count, int dest, int tag, char *data);
+void tiramisu_MPI_Issend_posted_int16(int count, int dest, int tag, short *data);
+void tiramisu_MPI_Issend_posted_int32(int count, int dest, int tag, int *data);
+void tiramisu_MPI_Issend_posted_int64(int count, int dest, int tag, long *data);
+void tiramisu_MPI_Issend_posted_uint8(int count, int dest, int tag, unsigned char *data);
+void tiramisu_MPI_Issend_posted_uint16(int count, int dest, int tag, unsigned short *data);
+void tiramisu_MPI_Issend_posted_uint32(int count, int dest, int tag, unsigned int *data);
+void tiramisu_MPI_Issend_posted_uint64(int count, int dest, int tag, unsigned long *data);
+void tiramisu_MPI_Issend_posted_f32(int count, int dest, int tag, float *data);
+void tiramisu_MPI_Issend_posted_f64(int count, int dest, int tag, double *data);
+
+void tiramisu_MPI_Irecv_posted_int8(int count, int source, int tag, char *store_in);
+void tiramisu_MPI_Irecv_posted_int16(int count, int source, int tag, short *store_in);
+void tiramisu_MPI_Irecv_posted_int32(int count, int source, int tag, int *store_in);
+void tiramisu_MPI_Irecv_posted_int64(int count, int source, int tag, long *store_in);
+void tiramisu_MPI_Irecv_posted_uint8(int count, int source, int tag, unsigned char *store_in);
+void tiramisu_MPI_Irecv_posted_uint16(int count, int source, int tag, unsigned short *store_in);
+void tiramisu_MPI_Irecv_posted_uint32(int count, int source, int tag, unsigned int *store_in);
+void tiramisu_MPI_Irecv_posted_uint64(int count, int source, int tag, unsigned long *store_in);
+void tiramisu_MPI_Irecv_posted_f32(int count, int source, int tag, float *store_in);
+void tiramisu_MPI_Irecv_posted_f64(int count, int source, int tag, double *store_in);
+
+/**
+  * Collectives (see tiramisu::collective).  The contribution of the rank is
+  * \p data and the result is stored in \p store_in.  The nonblocking
+  * versions (Iallreduce, ...) are posted transfers.
+  */
+void tiramisu_MPI_Allreduce_sum_int8(int count, char *data, char *store_in);
+void tiramisu_MPI_Allreduce_sum_int16(int count, short *data, short *store_in);
+void tiramisu_MPI_Allreduce_sum_int32(int count, int *data, int *store_in);
+void tiramisu_MPI_Allreduce_sum_int64(int count, long *data, long *store_in);
+void tiramisu_MPI_Allreduce_sum_uint8(int count, unsigned char *data, unsigned char *store_in);
+void tiramisu_MPI_Allreduce_sum_uint16(int count, unsigned short *data, unsigned short *store_in);
+void tiramisu_MPI_Allreduce_sum_uint32(int count, unsigned int *data, unsigned int *store_in);
+void tiramisu_MPI_Allreduce_sum_uint64(int count, unsigned long *data, unsigned long *store_in);
+void tiramisu_MPI_Allreduce_sum_f32(int count, float *data, float *store_in);
+void tiramisu_MPI_Allreduce_sum_f64(int count, double *data, double *store_in);
+
+void tiramisu_MPI_Allreduce_max_int8(int count, char *data, char *store_in);
+void tiramisu_MPI_Allreduce_max_int16(int count, short *data, short *store_in);
+void tiramisu_MPI_Allreduce_max_int32(int count, int *data, int *store_in);
+void tiramisu_MPI_Allreduce_max_int64(int count, long *data, long *store_in);
+void tiramisu_MPI_Allreduce_max_uint8(int count, unsigned char *data, unsigned char *store_in);
+void tiramisu_MPI_Allreduce_max_uint16(int count, unsigned short *data, unsigned short *store_in);
+void tiramisu_MPI_Allreduce_max_uint32(int count, unsigned int *data, unsigned int *store_in);
+void tiramisu_MPI_Allreduce_max_uint64(int count, unsigned long *data, unsigned long *store_in);
+void tiramisu_MPI_Allreduce_max_f32(int count, float *data, float *store_in);
+void tiramisu_MPI_Allreduce_max_f64(int count, double *data, double *store_in);
+
+void tiramisu_MPI_Allreduce_min_int8(int count, char *data, char *store_in);
+void tiramisu_MPI_Allreduce_min_int16(int count, short *data, short *store_in);
+void tiramisu_MPI_Allreduce_min_int32(int count, int *data, int *store_in);
+void tiramisu_MPI_Allreduce_min_int64(int count, long *data, long *store_in);
+void tiramisu_MPI_Allreduce_min_uint8(int count, unsigned char *data, unsigned char *store_in);
+void tiramisu_MPI_Allreduce_min_uint16(int count, unsigned short *data, unsigned short *store_in);
+void tiramisu_MPI_Allreduce_min_uint32(int count, unsigned int *data, unsigned int *store_in);
+void tiramisu_MPI_Allreduce_min_uint64(int count, unsigned long *data, unsigned long *store_in);
+void tiramisu_MPI_Allreduce_min_f32(int count, float *data, float *store_in);
+void tiramisu_MPI_Allreduce_min_f64(int count, double *data, double *store_in);
+
+void tiramisu_MPI_Iallreduce_sum_int8(int count, char *data, char *store_in);
+void tiramisu_MPI_Iallreduce_sum_int16(int count, short *data, short *store_in);
+void tiramisu_MPI_Iallreduce_sum_int32(int count, int *data, int *store_in);
+void tiramisu_MPI_Iallreduce_sum_int64(int count, long *data, long *store_in);
+void tiramisu_MPI_Iallreduce_sum_uint8(int count, unsigned char *data, unsigned char *store_in);
+void tiramisu_MPI_Iallreduce_sum_uint16(int count, unsigned short *data, unsigned short *store_in);
+void tiramisu_MPI_Iallreduce_sum_uint32(int count, unsigned int *data, unsigned int *store_in);
+void tiramisu_MPI_Iallreduce_sum_uint64(int count, unsigned long *data, unsigned long *store_in);
+void tiramisu_MPI_Iallreduce_sum_f32(int count, float *data, float *store_in);
+void tiramisu_MPI_Iallreduce_sum_f64(int count, double *data, double *store_in);
+
+void tiramisu_MPI_Iallreduce_max_int8(int count, char *data, char *store_in);
+void tiramisu_MPI_Iallreduce_max_int16(int count, short *data, short *store_in);
+void tiramisu_MPI_Iallreduce_max_int32(int count, int *data, int *store_in);
+void tiramisu_MPI_Iallreduce_max_int64(int count, long *data, long *store_in);
+void tiramisu_MPI_Iallreduce_max_uint8(int count, unsigned char *data, unsigned char *store_in);
+void tiramisu_MPI_Iallreduce_max_uint16(int count, unsigned short *data, unsigned short *store_in);
+void tiramisu_MPI_Iallreduce_max_uint32(int count, unsigned int *data, unsigned int *store_in);
+void tiramisu_MPI_Iallreduce_max_uint64(int count, unsigned long *data, unsigned long *store_in);
+void tiramisu_MPI_Iallreduce_max_f32(int count, float *data, float *store_in);
+void tiramisu_MPI_Iallreduce_max_f64(int count, double *data, double *store_in);
+
+void tiramisu_MPI_Iallreduce_min_int8(int count, char *data, char *store_in);
+void tiramisu_MPI_Iallreduce_min_int16(int count, short *data, short *store_in);
+void tiramisu_MPI_Iallreduce_min_int32(int count, int *data, int *store_in);
+void tiramisu_MPI_Iallreduce_min_int64(int count, long *data, long *store_in);
+void tiramisu_MPI_Iallreduce_min_uint8(int count, unsigned char *data, unsigned char *store_in);
+void tiramisu_MPI_Iallreduce_min_uint16(int count, unsigned short *data, unsigned short *store_in);
+void tiramisu_MPI_Iallreduce_min_uint32(int count, unsigned int *data, unsigned int *store_in);
+void tiramisu_MPI_Iallreduce_min_uint64(int count, unsigned long *data, unsigned long *store_in);
+void tiramisu_MPI_Iallreduce_min_f32(int count, float *data, float *store_in);
+void tiramisu_MPI_Iallreduce_min_f64(int count, double *data, double *store_in);
+
+void tiramisu_MPI_Reduce_scatter_sum_int8(int count, char *data, char *store_in);
+void tiramisu_MPI_Reduce_scatter_sum_int16(int count, short *data, short *store_in);
+void tiramisu_MPI_Reduce_scatter_sum_int32(int count, int *data, int *store_in);
+void tiramisu_MPI_Reduce_scatter_sum_int64(int count, long *data, long *store_in);
+void tiramisu_MPI_Reduce_scatter_sum_uint8(int count, unsigned char *data, unsigned char *store_in);
+void tiramisu_MPI_Reduce_scatter_sum_uint16(int count, unsigned short *data, unsigned short *store_in);
+void tiramisu_MPI_Reduce_scatter_sum_uint32(int count, unsigned int *data, unsigned int *store_in);
+void tiramisu_MPI_Reduce_scatter_sum_uint64(int count, unsigned long *data, unsigned long *store_in);
+void tiramisu_MPI_Reduce_scatter_sum_f32(int count, float *data, float *store_in);
+void tiramisu_MPI_Reduce_scatter_sum_f64(int count, double *data, double *store_in);
+
+void tiramisu_MPI_Reduce_scatter_max_int8(int count, char *data, char *store_in);
+void tiramisu_MPI_Reduce_scatter_max_int16(int count, short *data, short *store_in);
+void tiramisu_MPI_Reduce_scatter_max_int32(int count, int *data, int *store_in);
+void tiramisu_MPI_Reduce_scatter_max_int64(int count, long *data, long *store_in);
+void tiramisu_MPI_Reduce_scatter_max_uint8(int count, unsigned char *data, unsigned char *store_in);
+void tiramisu_MPI_Reduce_scatter_max_uint16(int count, unsigned short *data, unsigned short *store_in);
+void tiramisu_MPI_Reduce_scatter_max_uint32(int count, unsigned int *data, unsigned int *store_in);
+void tiramisu_MPI_Reduce_scatter_max_uint64(int count, unsigned long *data, unsigned long *store_in);
+void tiramisu_MPI_Reduce_scatter_max_f32(int count, float *data, float *store_in);
+void tiramisu_MPI_Reduce_scatter_max_f64(int count, double *data, double *store_in);
+
+void tiramisu_MPI_Reduce_scatter_min_int8(int count, char *data, char *store_in);
+void tiramisu_MPI_Reduce_scatter_min_int16(int count, short *data, short *store_in);
+void tiramisu_MPI_Reduce_scatter_min_int32(int count, int *data, int *store_in);
+void tiramisu_MPI_Reduce_scatter_min_int64(int count, long *data, long *store_in);
+void tiramisu_MPI_Reduce_scatter_min_uint8(int count, unsigned char *data, unsigned char *store_in);
+void tiramisu_MPI_Reduce_scatter_min_uint16(int count, unsigned short *data, unsigned short *store_in);
+void tiramisu_MPI_Reduce_scatter_min_uint32(int count, unsigned int *data, unsigned int *store_in);
+void tiramisu_MPI_Reduce_scatter_min_uint64(int count, unsigned long *data, unsigned long *store_in);
+void tiramisu_MPI_Reduce_scatter_min_f32(int count, float *data, float *store_in);
+void tiramisu_MPI_Reduce_scatter_min_f64(int count, double *data, double *store_in);
+
+void tiramisu_MPI_Ireduce_scatter_sum_int8(int count, char *data, char *store_in);
+void tiramisu_MPI_Ireduce_scatter_sum_int16(int count, short *data, short *store_in);
+void tiramisu_MPI_Ireduce_scatter_sum_int32(int count, int *data, int *store_in);
+void tiramisu_MPI_Ireduce_scatter_sum_int64(int count, long *data, long *store_in);
+void tiramisu_MPI_Ireduce_scatter_sum_uint8(int count, unsigned char *data, unsigned char *store_in);
+void tiramisu_MPI_Ireduce_scatter_sum_uint16(int count, unsigned short *data, unsigned short *store_in);
+void tiramisu_MPI_Ireduce_scatter_sum_uint32(int count, unsigned int *data, unsigned int *store_in);
+void tiramisu_MPI_Ireduce_scatter_sum_uint64(int count, unsigned long *data, unsigned long *store_in);
+void tiramisu_MPI_Ireduce_scatter_sum_f32(int count, float *data, float *store_in);
+void tiramisu_MPI_Ireduce_scatter_sum_f64(int count, double *data, double *store_in);
+
+void tiramisu_MPI_Ireduce_scatter_max_int8(int count, char *data, char *store_in);
+void tiramisu_MPI_Ireduce_scatter_max_int16(int count, short *data, short *store_in);
+void tiramisu_MPI_Ireduce_scatter_max_int32(int count, int *data, int *store_in);
+void tiramisu_MPI_Ireduce_scatter_max_int64(int count, long *data, long *store_in);
+void tiramisu_MPI_Ireduce_scatter_max_uint8(int count, unsigned char *data, unsigned char *store_in);
+void tiramisu_MPI_Ireduce_scatter_max_uint16(int count, unsigned short *data, unsigned short *store_in);
+void tiramisu_MPI_Ireduce_scatter_max_uint32(int count, unsigned int *data, unsigned int *store_in);
+void tiramisu_MPI_Ireduce_scatter_max_uint64(int count, unsigned long *data, unsigned long *store_in);
+void tiramisu_MPI_Ireduce_scatter_max_f32(int count, float *data, float *store_in);
+void tiramisu_MPI_Ireduce_scatter_max_f64(int count, double *data, double *store_in);
+
+void tiramisu_MPI_Ireduce_scatter_min_int8(int count, char *data, char *store_in);
+void tiramisu_MPI_Ireduce_scatter_min_int16(int count, short *data, short *store_in);
+void tiramisu_MPI_Ireduce_scatter_min_int32(int count, int *data, int *store_in);
+void tiramisu_MPI_Ireduce_scatter_min_int64(int count, long *data, long *store_in);
+void tiramisu_MPI_Ireduce_scatter_min_uint8(int count, unsigned char *data, unsigned char *store_in);
+void tiramisu_MPI_Ireduce_scatter_min_uint16(int count, unsigned short *data, unsigned short *store_in);
+void tiramisu_MPI_Ireduce_scatter_min_uint32(int count, unsigned int *data, unsigned int *store_in);
+void tiramisu_MPI_Ireduce_scatter_min_uint64(int count, unsigned long *data, unsigned long *store_in);
+void tiramisu_MPI_Ireduce_scatter_min_f32(int count, float *data, float *store_in);
+void tiramisu_MPI_Ireduce_scatter_min_f64(int count, double *data, double *store_in);
+
+void tiramisu_MPI_Bcast_int8(int count, int root, char *data, char *store_in);
+void tiramisu_MPI_Bcast_int16(int count, int root, short *data, short *store_in);
+void tiramisu_MPI_Bcast_int32(int count, int root, int *data, int *store_in);
+void tiramisu_MPI_Bcast_int64(int count, int root, long *data, long *store_in);
+void tiramisu_MPI_Bcast_uint8(int count, int root, unsigned char *data, unsigned char *store_in);
+void tiramisu_MPI_Bcast_uint16(int count, int root, unsigned short *data, unsigned short *store_in);
+void tiramisu_MPI_Bcast_uint32(int count, int root, unsigned int *data, unsigned int *store_in);
+void tiramisu_MPI_Bcast_uint64(int count, int root, unsigned long *data, unsigned long *store_in);
+void tiramisu_MPI_Bcast_f32(int count, int root, float *data, float *store_in);
+void tiramisu_MPI_Bcast_f64(int count, int root, double *data, double *store_in);
+
+void tiramisu_MPI_Ibcast_int8(int count, int root, char *data, char *store_in);
+void tiramisu_MPI_Ibcast_int16(int count, int root, short *data, short *store_in);
+void tiramisu_MPI_Ibcast_int32(int count, int root, int *data, int *store_in);
+void tiramisu_MPI_Ibcast_int64(int count, int root, long *data, long *store_in);
+void tiramisu_MPI_Ibcast_uint8(int count, int root, unsigned char *data, unsigned char *store_in);
+void tiramisu_MPI_Ibcast_uint16(int count, int root, unsigned short *data, unsigned short *store_in);
+void tiramisu_MPI_Ibcast_uint32(int count, int root, unsigned int *data, unsigned int *store_in);
+void tiramisu_MPI_Ibcast_uint64(int count, int root, unsigned long *data, unsigned long *store_in);
+void tiramisu_MPI_Ibcast_f32(int count, int root, float *data, float *store_in);
+void tiramisu_MPI_Ibcast_f64(int count, int root, double *data, double *store_in);
+
+void tiramisu_MPI_Allgather_int8(int count, char *data, char *store_in);
+void tiramisu_MPI_Allgather_int16(int count, short *data, short *store_in);
+void tiramisu_MPI_Allgather_int32(int count, int *data, int *store_in);
+void tiramisu_MPI_Allgather_int64(int count, long *data, long *store_in);
+void tiramisu_MPI_Allgather_uint8(int count, unsigned char *data, unsigned char *store_in);
+void tiramisu_MPI_Allgather_uint16(int count, unsigned short *data, unsigned short *store_in);
+void tiramisu_MPI_Allgather_uint32(int count, unsigned int *data, unsigned int *store_in);
+void tiramisu_MPI_Allgather_uint64(int count, unsigned long *data, unsigned long *store_in);
+void tiramisu_MPI_Allgather_f32(int count, float *data, float *store_in);
+void tiramisu_MPI_Allgather_f64(int count, double *data, double *store_in);
+
+void tiramisu_MPI_Iallgather_int8(int count, char *data, char *store_in);
+void tiramisu_MPI_Iallgather_int16(int count, short *data, short *store_in);
+void tiramisu_MPI_Iallgather_int32(int count, int *data, int *store_in);
+void tiramisu_MPI_Iallgather_int64(int count, long *data, long *store_in);
+void tiramisu_MPI_Iallgather_uint8(int count, unsigned char *data, unsigned char *store_in);
+void tiramisu_MPI_Iallgather_uint16(int count, unsigned short *data, unsigned short *store_in);
+void tiramisu_MPI_Iallgather_uint32(int count, unsigned int *data, unsigned int *store_in);
+void tiramisu_MPI_Iallgather_uint64(int count, unsigned long *data, unsigned long *store_in);
+void tiramisu_MPI_Iallgather_f32(int count, float *data, float *store_in);
+void tiramisu_MPI_Iallgather_f64(int count, double *data, double *store_in);
+
+/**
+  * One-sided transfers.  tiramisu_MPI_Win_expose() exposes the buffer at
+  * \p base (\p size bytes) as the MPI window \p name; it is collective, and
+  * the window is only recreated if the buffer changed on some rank.
+  * tiramisu_MPI_Win_fence() opens or closes an epoch on the window \p name.
+  * Put writes \p data into the window that contains \p store_in on the rank
+  * \p target, Get reads the window that contains \p data on the rank
+  * \p source into \p store_in; the buffers have the same layout on every
+  * rank.
+  */
+int tiramisu_MPI_Win_expose(const char *name, void *base, unsigned long size);
+int tiramisu_MPI_Win_fence(const char *name);
+
+/**
+  * Allocate \p size bytes that the ranks of a node share through an MPI-3
+  * shared-memory window (collective over the ranks of the node).  The
+  * one-sided transfers between the ranks of a node on buffers allocated this
+  * way are plain copies instead of MPI_Put/MPI_Get.  The generated code uses
+  * these functions for the buffers marked with buffer::set_node_shared().
+  * Freeing is collective too, and also frees the windows that expose the
+  * memory.
+  */
+void *tiramisu_MPI_alloc_node_shared(unsigned long size);
+int tiramisu_MPI_free_node_shared(void *base);
+
+void tiramisu_MPI_Put_int8(int count, int target, char *data, char *store_in);
+void tiramisu_MPI_Put_int16(int count, int target, short *data, short *store_in);
+void tiramisu_MPI_Put_int32(int count, int target, int *data, int *store_in);
+void tiramisu_MPI_Put_int64(int count, int target, long *data, long *store_in);
+void tiramisu_MPI_Put_uint8(int count, int target, unsigned char *data, unsigned char *store_in);
+void tiramisu_MPI_Put_uint16(int count, int target, unsigned short *data, unsigned short *store_in);
+void tiramisu_MPI_Put_uint32(int count, int target, unsigned int *data, unsigned int *store_in);
+void tiramisu_MPI_Put_uint64(int count, int target, unsigned long *data, unsigned long *store_in);
+void tiramisu_MPI_Put_f32(int count, int target, float *data, float *store_in);
+void tiramisu_MPI_Put_f64(int count, int target, double *data, double *store_in);
+
+void tiramisu_MPI_Get_int8(int count, int source, char *data, char *store_in);
+void tiramisu_MPI_Get_int16(int count, int source, short *data, short *store_in);
+void tiramisu_MPI_Get_int32(int count, int source, int *data, int *store_in);
+void tiramisu_MPI_Get_int64(int count, int source, long *data, long *store_in);
+void tiramisu_MPI_Get_uint8(int count, int source, unsigned char *data, unsigned char *store_in);
+void tiramisu_MPI_Get_uint16(int count, int source, unsigned short *data, unsigned short *store_in);
+void tiramisu_MPI_Get_uint32(int count, int source, unsigned int *data, unsigned int *store_in);
+void tiramisu_MPI_Get_uint64(int count, int source, unsigned long *data, unsigned long *store_in);
+void tiramisu_MPI_Get_f32(int count, int source, float *data, float *store_in);
+void tiramisu_MPI_Get_f64(int count, int source, double *data, double *store_in);
+
+/**
+  * Persistent requests, used for the transfers that are repeated with the
+  * same arguments by every iteration of a loop.
+  * tiramisu_MPI_persistent_requests() creates \p count consecutive empty
+  * requests and returns the index of the first one.  The *_init functions
+  * initialize the request \p request if \p active is true (otherwise the
+  * request stays empty and is ignored).
+  */
+int tiramisu_MPI_persistent_requests(int count);
+int tiramisu_MPI_Startall(int first, int count);
+int tiramisu_MPI_Waitall_persistent(int first, int count);
+int tiramisu_MPI_persistent_requests_free(int first, int count);
+
+int tiramisu_MPI_Send_init_int8(int request, int active, int count, int dest, int tag, char *data);
+int tiramisu_MPI_Send_init_int16(int request, int active, int count, int dest, int tag, short *data);
+int tiramisu_MPI_Send_init_int32(int request, int active, int count, int dest, int tag, int *data);
+int tiramisu_MPI_Send_init_int64(int request, int active, int count, int dest, int tag, long *data);
+int tiramisu_MPI_Send_init_uint8(int request, int active, int count, int dest, int tag, unsigned char *data);
+int tiramisu_MPI_Send_init_uint16(int request, int active, int count, int dest, int tag, unsigned short *data);
+int tiramisu_MPI_Send_init_uint32(int request, int active, int count, int dest, int tag, unsigned int *data);
+int tiramisu_MPI_Send_init_uint64(int request, int active, int count, int dest, int tag, unsigned long *data);
+int tiramisu_MPI_Send_init_f32(int request, int active, int count, int dest, int tag, float *data);
+int tiramisu_MPI_Send_init_f64(int request, int active, int count, int dest, int tag, double *data);
+
+int tiramisu_MPI_Ssend_init_int8(int request, int active, int count, int dest, int tag, char *data);
+int tiramisu_MPI_Ssend_init_int16(int request, int active, int count, int dest, int tag, short *data);
+int tiramisu_MPI_Ssend_init_int32(int request, int active, int count, int dest, int tag, int *data);
+int tiramisu_MPI_Ssend_init_int64(int request, int active, int count, int dest, int tag, long *data);
+int tiramisu_MPI_Ssend_init_uint8(int request, int active, int count, int dest, int tag, unsigned char *data);
+int tiramisu_MPI_Ssend_init_uint16(int request, int active, int count, int dest, int tag, unsigned short *data);
+int tiramisu_MPI_Ssend_init_uint32(int request, int active, int count, int dest, int tag, unsigned int *data);
+int tiramisu_MPI_Ssend_init_uint64(int request, int active, int count, int dest, int tag, unsigned long *data);
+int tiramisu_MPI_Ssend_init_f32(int request, int active, int count, int dest, int tag, float *data);
+int tiramisu_MPI_Ssend_init_f64(int request, int active, int count, int dest, int tag, double *data);
+
+int tiramisu_MPI_Recv_init_int8(int request, int active, int count, int source, int tag, char *store_in);
+int tiramisu_MPI_Recv_init_int16(int request, int active, int count, int source, int tag, short *store_in);
+int tiramisu_MPI_Recv_init_int32(int request, int active, int count, int source, int tag, int *store_in);
+int tiramisu_MPI_Recv_init_int64(int request, int active, int count, int source, int tag, long *store_in);
+int tiramisu_MPI_Recv_init_uint8(int request, int active, int count, int source, int tag, unsigned char *store_in);
+int tiramisu_MPI_Recv_init_uint16(int request, int active, int count, int source, int tag, unsigned short *store_in);
+int tiramisu_MPI_Recv_init_uint32(int request, int active, int count, int source, int tag, unsigned int *store_in);
+int tiramisu_MPI_Recv_init_uint64(int request, int active, int count, int source, int tag, unsigned long *store_in);
+int tiramisu_MPI_Recv_init_f32(int request, int active, int count, int source, int tag, float *store_in);
+int tiramisu_MPI_Recv_init_f64(int request, int active, int count, int source, int tag, double *store_in);
+
+/**
+  * Aggregated transfers.  A send appends its elements to the message of the
+  * communication phase for (\p dest, \p tag), and
+  * tiramisu_MPI_aggregated_flush() sends all these messages (one per peer
+  * and tag) at the end of the phase.  The messages are sent as bytes, so
+  * the transfers of a tag may have different element types.  A receive
+  * reads its elements from the next message received from (\p source,
+  * \p tag).
+  * tiramisu_MPI_aggregated_wait() completes the flushed messages.
+  */
+int tiramisu_MPI_aggregated_flush();
+int tiramisu_MPI_aggregated_wait();
+
+void tiramisu_MPI_Send_aggregated_int8(int count, int dest, int tag, char *data);
+void tiramisu_MPI_Send_aggregated_int16(int count, int dest, int tag, short *data);
+void tiramisu_MPI_Send_aggregated_int32(int count, int dest, int tag, int *data);
+void tiramisu_MPI_Send_aggregated_int64(int count, int dest, int tag, long *data);
+void tiramisu_MPI_Send_aggregated_uint8(int count, int dest, int tag, unsigned char *data);
+void tiramisu_MPI_Send_aggregated_uint16(int count, int dest, int tag, unsigned short *data);
+void tiramisu_MPI_Send_aggregated_uint32(int count, int dest, int tag, unsigned int *data);
+void tiramisu_MPI_Send_aggregated_uint64(int count, int dest, int tag, unsigned long *data);
+void tiramisu_MPI_Send_aggregated_f32(int count, int dest, int tag, float *data);
+void tiramisu_MPI_Send_aggregated_f64(int count, int dest, int tag, double *data);
+
+void tiramisu_MPI_Recv_aggregated_int8(int count, int source, int tag, char *store_in);
+void tiramisu_MPI_Recv_aggregated_int16(int count, int source, int tag, short *store_in);
+void tiramisu_MPI_Recv_aggregated_int32(int count, int source, int tag, int *store_in);
+void tiramisu_MPI_Recv_aggregated_int64(int count, int source, int tag, long *store_in);
+void tiramisu_MPI_Recv_aggregated_uint8(int count, int source, int tag, unsigned char *store_in);
+void tiramisu_MPI_Recv_aggregated_uint16(int count, int source, int tag, unsigned short *store_in);
+void tiramisu_MPI_Recv_aggregated_uint32(int count, int source, int tag, unsigned int *store_in);
+void tiramisu_MPI_Recv_aggregated_uint64(int count, int source, int tag, unsigned long *store_in);
+void tiramisu_MPI_Recv_aggregated_f32(int count, int source, int tag, float *store_in);
+void tiramisu_MPI_Recv_aggregated_f64(int count, int source, int tag, double *store_in);
+
 }
 #endif
 #endif
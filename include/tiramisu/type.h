@@ -148,6 +148,57 @@ enum class rank_t
     r_receiver
 };
 
+/**
+  * Strategies used to parallelize an update whose parallel iterations
+  * may write to the same location.
+  * "u_" stands for update.
+  */
+enum update_strategy_t
+{
+    u_auto,
+    u_atomic,
+    u_privatize
+};
+
+/**
+  * Policies used to distribute the iterations of a parallel loop over
+  * the threads.
+  * "s_" stands for schedule.
+  */
+enum parallel_schedule_t
+{
+    s_default,  // The distribution of the Halide runtime (one iteration at a time).
+    s_static,   // Chunks assigned round-robin to the threads.
+    s_dynamic,  // Chunks taken by the threads as they become idle.
+    s_guided    // Dynamic, with chunks that get smaller as the loop progresses.
+};
+
+/**
+  * Policies used to distribute the iterations of a distributed loop over
+  * the ranks.
+  * "d_" stands for distribution.
+  */
+enum distribution_t
+{
+    d_rank,         // The iteration i is executed by the rank i.
+    d_block,        // One contiguous block of iterations per rank.
+    d_cyclic,       // Iterations assigned round-robin to the ranks.
+    d_block_cyclic, // Blocks of iterations assigned round-robin to the ranks.
+    d_weighted      // One contiguous block per rank, proportional to the weight of the rank.
+};
+
+/**
+  * How a vectorized loop executes the iterations that do not fill a
+  * whole vector.
+  * "v_" stands for vectorization.
+  */
+enum vector_tail_t
+{
+    v_epilogue, // A separate scalar loop.
+    v_masked,   // A vector iteration with masked (predicated) loads and stores.
+    v_padded    // A full vector iteration (the accessed buffers are padded).
+};
+
 /**
   * Convert a Tiramisu type into the equivalent Halide type (if it exists),
   * otherwise show an error message (no automatic type conversion is performed).
@@ -53,6 +53,12 @@ void block::parallelize(var L) {
     }
 }
 
+void block::parallelize(var L, parallel_schedule_t policy, int chunk_size) {
+    for (auto &child : this->children) {
+        child->parallelize(L, policy, chunk_size);
+    }
+}
+
 void block::shift(var L0, int n) {
     for (auto &child : this->children) {
         child->shift(L0, n);
@@ -201,5 +207,17 @@ void block::vectorize(var L, int v, var L_outer, var L_inner) {
     }
 }
 
+void block::vectorize(var L, int v, vector_tail_t tail) {
+    for (auto &child : this->children) {
+        child->vectorize(L, v, tail);
+    }
+}
+
+void block::vectorize(var L, int v, vector_tail_t tail, var L_outer, var L_inner) {
+    for (auto &child : this->children) {
+        child->vectorize(L, v, tail, L_outer, L_inner);
+    }
+}
+
 
 }  // namespace tiramisu
@@ -14,6 +14,8 @@
 #include <tiramisu/type.h>
 #include <tiramisu/expr.h>
 
+#include <functional>
+#include <set>
 #include <string>
 #include "../include/tiramisu/expr.h"
 #include "../3rdParty/Halide/src/Expr.h"
@@ -1700,6 +1702,26 @@ tiramisu::generator::halide_stmt_from_isl_node(const tiramisu::function &fct, is
 
         isl_ast_node_list *list = isl_ast_node_block_get_children(node);
 
+        // Consecutive children that can be executed as tasks and that do
+        // not depend on each other are collected in a group, which is
+        // executed concurrently.
+        std::vector<Halide::Internal::Stmt> task_group;
+        std::set<std::string> task_group_reads, task_group_writes;
+        auto flush_task_group = [&]() {
+            if (task_group.empty())
+            {
+                return;
+            }
+            // The children are visited from the last one.
+            std::reverse(task_group.begin(), task_group.end());
+            Halide::Internal::Stmt tasks = (task_group.size() == 1) ? task_group[0] :
+                                           generator::make_task_parallel_block(task_group);
+            result = result.defined() ? generator::make_halide_block(tasks, result) : tasks;
+            task_group.clear();
+            task_group_reads.clear();
+            task_group_writes.clear();
+        };
+
         for (int i = isl_ast_node_list_n_ast_node(list) - 1; i >= 0; i--)
         {
             isl_ast_node *child = isl_ast_node_list_get_ast_node(list, i);
@@ -1711,6 +1733,10 @@ tiramisu::generator::halide_stmt_from_isl_node(const tiramisu::function &fct, is
             if (isl_ast_node_get_type(child) == isl_ast_node_user)
                 op_type = get_computation_annotated_in_a_node(child)->get_expr().get_op_type();
 
+            std::set<std::string> task_reads, task_writes;
+            bool is_task = (op_type != o_allocate) && (op_type != o_free) && (op_type != o_memcpy) &&
+                           generator::get_task_accesses(fct, child, task_reads, task_writes);
+
             if ((isl_ast_node_get_type(child) == isl_ast_node_user) &&
                 (op_type == o_allocate || op_type == o_free || op_type == o_memcpy))
             {
@@ -1812,6 +1838,25 @@ tiramisu::generator::halide_stmt_from_isl_node(const tiramisu::function &fct, is
 
             DEBUG_NO_NEWLINE(10, tiramisu::str_dump("Generated block: "); std::cout << block);
 
+            if (is_task && block.defined())
+            {
+                bool independent = true;
+                for (const auto &b : task_writes)
+                    independent = independent && !task_group_reads.count(b) && !task_group_writes.count(b);
+                for (const auto &b : task_reads)
+                    independent = independent && !task_group_writes.count(b);
+                if (!independent)
+                {
+                    flush_task_group();
+                }
+                DEBUG(3, tiramisu::str_dump("Adding the block to a group of " + std::to_string(task_group.size()) + " tasks."));
+                task_group.push_back(block);
+                task_group_reads.insert(task_reads.begin(), task_reads.end());
+                task_group_writes.insert(task_writes.begin(), task_writes.end());
+                continue;
+            }
+            flush_task_group();
+
             if (block.defined() == false) // Probably block is a let stmt.
             {
                 DEBUG(3, tiramisu::str_dump("Block undefined."));
@@ -1859,6 +1904,7 @@ tiramisu::generator::halide_stmt_from_isl_node(const tiramisu::function &fct, is
             }
             DEBUG(3, std::cout << "Result is now: " << result);
         }
+        flush_task_group();
 
         /**
          *  Generate all the "allocate" statements (which should be declared on all the block)
@@ -1914,6 +1960,11 @@ tiramisu::generator::halide_stmt_from_isl_node(const tiramisu::function &fct, is
 //                           buf->get_name(),
 //                           halide_type_from_tiramisu_type(buf->get_elements_type()),
 //                           halide_dim_sizes, Halide::Internal::const_true(), result);
+                    if (buf->get_node_shared())
+                    {
+                        ERROR("The node-shared buffer " + buf->get_name() +
+                              " must be allocated automatically at the beginning of the function.", true);
+                    }
                     result = make_buffer_alloc(buf, halide_dim_sizes, result);
 
 
@@ -2049,11 +2100,15 @@ tiramisu::generator::halide_stmt_from_isl_node(const tiramisu::function &fct, is
             // current level was marked as such.
             size_t tt = 0;
             bool convert_to_conditional = false;
+            std::string parallel_comp;
+            std::string distributed_comp;
+            Halide::Expr vector_mask;
             while (tt < tagged_stmts.size()) {
                 if (tagged_stmts[tt].first != "") {
                     if (tagged_stmts[tt].second == "parallelize" &&
                         fct.should_parallelize(tagged_stmts[tt].first, level)) {
                         fortype = Halide::Internal::ForType::Parallel;
+                        parallel_comp = tagged_stmts[tt].first;
                         // Since this statement is treated, remove it from the list of
                         // tagged statements so that it does not get treated again later.
                         tagged_stmts[tt].first = "";
@@ -2085,8 +2140,16 @@ tiramisu::generator::halide_stmt_from_isl_node(const tiramisu::function &fct, is
                         DEBUG(3, tiramisu::str_dump("Vector length = ");
                                 tiramisu::str_dump(std::to_string(vector_length)));
 
+                        // The loop executes a whole vector.  A masked tail
+                        // predicates the lanes past the original upper bound.
+                        if (fct.get_vector_tail(tagged_stmts[tt].first, level) == tiramisu::v_masked) {
+                            vector_mask = Halide::Internal::Variable::make(init_expr.type(), iterator_str) <
+                                          cond_upper_bound_halide_format;
+                        }
+
                         // Currently we assume that when vectorization is used,
-                        // then the original loop extent is > vector_length.
+                        // then the original loop extent is > vector_length
+                        // (unless the tail is masked or padded).
                         cond_upper_bound_halide_format = Halide::Expr(vector_length);
                         fortype = Halide::Internal::ForType::Vectorized;
                         DEBUG(3, tiramisu::str_dump("Loop vectorized"));
@@ -2196,6 +2259,7 @@ tiramisu::generator::halide_stmt_from_isl_node(const tiramisu::function &fct, is
                                fct.should_distribute(tagged_stmts[tt].first, level)) {
                         // Change this loop into an if statement instead
                         convert_to_conditional = true;
+                        distributed_comp = tagged_stmts[tt].first;
                         tagged_stmts[tt].first = "";
                         break;
                     }
@@ -2203,11 +2267,41 @@ tiramisu::generator::halide_stmt_from_isl_node(const tiramisu::function &fct, is
                 tt++;
             }
 
+            // Prefetches are not exclusive with the other tags, so they are
+            // handled separately: insert the prefetches requested at this
+            // level at the beginning of the loop body.
+            std::set<std::string> prefetched_buffers;
+            for (auto &ts: tagged_stmts) {
+                if (ts.first != "" && ts.second == "prefetch" && fct.should_prefetch(ts.first, level)) {
+                    for (const auto &pf: fct.get_prefetches(ts.first, level)) {
+                        if (fortype == Halide::Internal::ForType::Vectorized || convert_to_conditional) {
+                            DEBUG(3, tiramisu::str_dump("Prefetch of " + pf.first + " ignored (the loop is vectorized or distributed)."));
+                        } else if (prefetched_buffers.insert(pf.first).second) {
+                            halide_body = generator::make_prefetch(pf.first, iterator_str, pf.second, halide_body);
+                        }
+                    }
+                    ts.first = "";
+                }
+            }
+
+            if (vector_mask.defined()) {
+                halide_body = generator::make_masked_vector_body(halide_body, vector_mask);
+            }
+
             DEBUG(10, tiramisu::str_dump("The full list of tagged statements is now:"));
             for (const auto &ts: tagged_stmts) DEBUG(10, tiramisu::str_dump(ts.first + " with tag " + ts.second));
             DEBUG(10, tiramisu::str_dump(""));
 
-            if (convert_to_conditional) {
+            auto distribution = convert_to_conditional ? fct.get_distribution_policy(distributed_comp, level)
+                                                       : std::make_tuple(tiramisu::d_rank, 0, std::vector<int>());
+            if (convert_to_conditional && std::get<0>(distribution) != tiramisu::d_rank) {
+                DEBUG(3, tiramisu::str_dump("Restricting the distributed loop to the iterations of the rank."));
+                result = Halide::Internal::For::make(iterator_str, init_expr,
+                                                     cond_upper_bound_halide_format - init_expr,
+                                                     Halide::Internal::ForType::Serial, dev_api, halide_body);
+                result = generator::make_distributed_loop(result, std::get<0>(distribution),
+                                                          std::get<1>(distribution), std::get<2>(distribution));
+            } else if (convert_to_conditional) {
                 DEBUG(3, tiramisu::str_dump("Converting for loop into a rank conditional."));
                 Halide::Expr rank_var =
                         Halide::Internal::Variable::make(
@@ -2225,6 +2319,73 @@ tiramisu::generator::halide_stmt_from_isl_node(const tiramisu::function &fct, is
                                                      fortype, dev_api, halide_body);
                 DEBUG(3, tiramisu::str_dump("For loop created."));
                 DEBUG(10, std::cout << result);
+
+                // Collapse the loops nested in this loop into it.
+                for (auto &ts: tagged_stmts) {
+                    if (ts.first != "" && ts.second == "collapse" && fct.get_collapse_depth(ts.first, level) > 0) {
+                        result = generator::make_collapsed_loop(result, fct.get_collapse_depth(ts.first, level));
+                        ts.first = "";
+                    }
+                }
+
+                // Unroll and jam this loop into the innermost loop.
+                for (auto &ts: tagged_stmts) {
+                    if (ts.first != "" && ts.second == "unroll_and_jam" &&
+                        fct.get_unroll_and_jam_factor(ts.first, level) > 0) {
+                        if (fortype == Halide::Internal::ForType::Serial ||
+                            fortype == Halide::Internal::ForType::Parallel) {
+                            result = generator::make_unroll_and_jam(result, fct.get_unroll_and_jam_factor(ts.first, level));
+                        } else {
+                            DEBUG(3, tiramisu::str_dump("Unroll and jam of " + ts.first + " ignored (the loop is vectorized or unrolled)."));
+                        }
+                        ts.first = "";
+                    }
+                }
+
+                // Promote the accesses that are invariant in this loop to registers.
+                for (auto &ts: tagged_stmts) {
+                    if (ts.first != "" && ts.second == "promote_to_register" &&
+                        fct.should_promote_to_register(ts.first, level)) {
+                        if (result.as<Halide::Internal::For>() != NULL) {
+                            result = generator::make_register_promotion(result);
+                        } else {
+                            DEBUG(3, tiramisu::str_dump("Register promotion of " + ts.first + " ignored (the loop was transformed)."));
+                        }
+                        ts.first = "";
+                    }
+                }
+
+                // Distribute the iterations of a parallel loop using the
+                // policy requested by the user.  A pipelined wavefront
+                // relies on the in-order distribution of the runtime, so
+                // it keeps it.
+                if (fortype == Halide::Internal::ForType::Parallel && !parallel_comp.empty()) {
+                    auto schedule = fct.get_parallel_schedule(parallel_comp, level);
+                    if (schedule.first != tiramisu::s_default) {
+                        if (fct.should_pipeline_wavefront(parallel_comp, level)) {
+                            DEBUG(3, tiramisu::str_dump("Parallel schedule of " + parallel_comp + " ignored (the loop is a pipelined wavefront)."));
+                        } else {
+                            result = generator::make_parallel_schedule(result, schedule.first, schedule.second);
+                        }
+                    }
+                }
+
+                // Replace the barriers between the wavefronts of a pipelined
+                // wavefront by point to point synchronization.
+                for (auto &ts: tagged_stmts) {
+                    if (ts.first != "" && ts.second == "wavefront_pipeline" &&
+                        fct.should_pipeline_wavefront(ts.first, level)) {
+                        if (fortype == Halide::Internal::ForType::Parallel) {
+                            const auto &comps = fct.get_computation_by_name(ts.first);
+                            assert(!comps.empty() && (comps[0]->get_buffer() != nullptr));
+                            result = generator::make_wavefront_pipeline(result, comps[0]->get_buffer()->get_name(),
+                                                                        fct.get_wavefront_lags(ts.first, level));
+                        } else {
+                            DEBUG(3, tiramisu::str_dump("Wavefront pipeline of " + ts.first + " ignored (the loop is not parallel)."));
+                        }
+                        ts.first = "";
+                    }
+                }
             }
 
             isl_ast_expr_free(init);
@@ -2282,6 +2443,16 @@ tiramisu::generator::halide_stmt_from_isl_node(const tiramisu::function &fct, is
                     tagged_stmts.push_back(std::pair<std::string, std::string>(computation_name, "unroll"));
                 if (fct.should_distribute(computation_name, l))
                     tagged_stmts.push_back(std::pair<std::string, std::string>(computation_name, "distribute"));
+                if (fct.should_prefetch(computation_name, l))
+                    tagged_stmts.push_back(std::pair<std::string, std::string>(computation_name, "prefetch"));
+                if (fct.should_pipeline_wavefront(computation_name, l))
+                    tagged_stmts.push_back(std::pair<std::string, std::string>(computation_name, "wavefront_pipeline"));
+                if (fct.get_collapse_depth(computation_name, l) > 0)
+                    tagged_stmts.push_back(std::pair<std::string, std::string>(computation_name, "collapse"));
+                if (fct.get_unroll_and_jam_factor(computation_name, l) > 0)
+                    tagged_stmts.push_back(std::pair<std::string, std::string>(computation_name, "unroll_and_jam"));
+                if (fct.should_promote_to_register(computation_name, l))
+                    tagged_stmts.push_back(std::pair<std::string, std::string>(computation_name, "promote_to_register"));
 
                 DEBUG(10, tiramisu::str_dump("The full list of tagged statements is now"));
                 for (const auto &ts: tagged_stmts)
@@ -2427,11 +2598,37 @@ void function::gen_halide_stmt()
 
     DEBUG(3, tiramisu::str_dump("The following Halide statement was generated:\n"); std::cout << stmt << std::endl);
 
+    if (this->needs_rank_call())
+    {
+        stmt = generator::make_message_aggregation(stmt);
+        if (this->persistent_communication)
+        {
+            stmt = generator::make_persistent_communication(stmt);
+        }
+        stmt = generator::make_rma_epochs(*this, stmt);
+    }
+
+    // Preallocate the MPI requests of the nonblocking transfers so that
+    // posting a transfer does not allocate memory.
+    int request_count = this->get_nonblocking_request_count();
+    if (request_count > 0)
+    {
+        stmt = generator::make_batched_waits(stmt);
+        stmt = generator::make_request_tests(stmt);
+        stmt = Halide::Internal::Block::make(
+                Halide::Internal::Evaluate::make(
+                        Halide::Internal::Call::make(Halide::Int(32), "tiramisu_MPI_request_pool_reserve",
+                                                     {request_count}, Halide::Internal::Call::Extern)),
+                stmt);
+    }
+
     Halide::Internal::Stmt freestmts;
     for (const auto &b : this->get_buffers())
     {
         tiramisu::buffer *buf = b.second;
-        if (buf->get_argument_type() == tiramisu::a_temporary && buf->get_auto_allocate() == true && buf->location == cuda_ast::memory_location::global)
+        if (buf->get_argument_type() == tiramisu::a_temporary && buf->get_auto_allocate() == true &&
+            (buf->location == cuda_ast::memory_location::global ||
+             (buf->location == cuda_ast::memory_location::host && buf->get_node_shared())))
         {
             auto free = generator::make_buffer_free(buf);
             if (freestmts.defined())
@@ -2521,10 +2718,46 @@ Halide::Internal::Stmt generator::make_buffer_alloc(buffer *b, const std::vector
     auto h_type = halide_type_from_tiramisu_type(b->get_elements_type());
     if (b->location == memory_location::host)
     {
+        Halide::Internal::Stmt body = stmt;
+
+        // The pages should be touched after the huge page advice, so that
+        // the advice applies to them.
+        if (b->get_numa_first_touch())
+        {
+            body = Halide::Internal::Block::make(generator::make_buffer_first_touch(b, extents), body);
+        }
+        Halide::Expr size = Halide::cast(Halide::UInt(64), extents[0]);
+        for (int i = 1; i < extents.size(); i++)
+        {
+            size = size * Halide::cast(Halide::UInt(64), extents[i]);
+        }
+        if (b->get_huge_pages())
+        {
+            Halide::Internal::Stmt advice = Halide::Internal::Evaluate::make(
+                    Halide::Internal::Call::make(Halide::Int(32), "tiramisu_madvise_huge_pages",
+                                                 {Halide::Internal::Variable::make(Halide::type_of<void *>(), b->get_name()),
+                                                  size * h_type.bytes()}, Halide::Internal::Call::Extern));
+            body = Halide::Internal::Block::make(advice, body);
+        }
+
+        if (b->get_node_shared())
+        {
+            // The buffer is freed by make_buffer_free(), which calls the
+            // collective tiramisu_MPI_free_node_shared(); Halide does not
+            // free it.
+            return Halide::Internal::Allocate::make(
+                    b->get_name(),
+                    h_type,
+                    extents, Halide::Internal::const_true(), body,
+                    Halide::Internal::Call::make(Halide::Handle(), "tiramisu_MPI_alloc_node_shared",
+                                                 {size * h_type.bytes()}, Halide::Internal::Call::Extern),
+                    "halide_device_host_nop_free");
+        }
+
         return Halide::Internal::Allocate::make(
                 b->get_name(),
                 h_type,
-                extents, Halide::Internal::const_true(), stmt);
+                extents, Halide::Internal::const_true(), body);
     }
     else if (b->location == memory_location::global)
     {
@@ -2546,6 +2779,65 @@ Halide::Internal::Stmt generator::make_buffer_alloc(buffer *b, const std::vector
 
 }
 
+Halide::Internal::Stmt generator::make_buffer_first_touch(buffer *b, const std::vector<Halide::Expr> &extents)
+{
+    DEBUG_FCT_NAME(3);
+    DEBUG_INDENT(4);
+
+    assert(b != nullptr);
+    assert(!extents.empty());
+
+    Halide::Type it_type = halide_type_from_tiramisu_type(global::get_loop_iterator_data_type());
+    auto h_type = halide_type_from_tiramisu_type(b->get_elements_type());
+
+    // Touch one element per (small) page.
+    const int page_size = 4096;
+    int page_elems = std::max(page_size / h_type.bytes(), 1);
+
+    // The outermost dimension is the last one in Halide's order.  The
+    // other dimensions form the slice touched by each parallel iteration.
+    Halide::Expr outer_extent = Halide::cast(it_type, extents.back());
+    Halide::Expr slice_size = Halide::cast(it_type, 1);
+    for (int i = 0; i < (int) extents.size() - 1; i++)
+    {
+        slice_size = slice_size * Halide::cast(it_type, extents[i]);
+    }
+
+    std::string outer = "_" + b->get_name() + "_first_touch_outer";
+    std::string page = "_" + b->get_name() + "_first_touch_page";
+    Halide::Expr outer_var = Halide::Internal::Variable::make(it_type, outer);
+    Halide::Expr page_var = Halide::Internal::Variable::make(it_type, page);
+
+    Halide::Internal::Stmt stmt;
+    if (extents.size() == 1)
+    {
+        // A single dimension: parallelize over the pages.
+        stmt = Halide::Internal::Store::make(
+                b->get_name(), Halide::Internal::make_zero(h_type), page_var * page_elems,
+                Halide::Internal::Parameter(), Halide::Internal::const_true());
+        stmt = Halide::Internal::For::make(page, Halide::cast(it_type, 0),
+                                           (outer_extent + page_elems - 1) / page_elems,
+                                           Halide::Internal::ForType::Parallel, Halide::DeviceAPI::Host, stmt);
+    }
+    else
+    {
+        stmt = Halide::Internal::Store::make(
+                b->get_name(), Halide::Internal::make_zero(h_type), outer_var * slice_size + page_var * page_elems,
+                Halide::Internal::Parameter(), Halide::Internal::const_true());
+        stmt = Halide::Internal::For::make(page, Halide::cast(it_type, 0),
+                                           (slice_size + page_elems - 1) / page_elems,
+                                           Halide::Internal::ForType::Serial, Halide::DeviceAPI::Host, stmt);
+        stmt = Halide::Internal::For::make(outer, Halide::cast(it_type, 0), outer_extent,
+                                           Halide::Internal::ForType::Parallel, Halide::DeviceAPI::Host, stmt);
+    }
+
+    DEBUG(3, tiramisu::str_dump("First touch of the buffer " + b->get_name() + ":"); std::cout << stmt);
+
+    DEBUG_INDENT(-4);
+
+    return stmt;
+}
+
 isl_ast_node *for_code_generator_after_for(isl_ast_node *node, isl_ast_build *build, void *user)
 {
     return node;
@@ -2932,7 +3224,9 @@ void computation::create_halide_assignment()
     }
     else {
         DEBUG(3, tiramisu::str_dump("This is not a let statement."));
-        if (this->is_send() || this->is_recv()) {
+        if (this->is_send() || this->is_recv() ||
+            (this->is_send_recv() &&
+             static_cast<tiramisu::communicator *>(this)->get_xfer_props().contains_attr(tiramisu::MPI))) {
           // This is the iterator, but it is still in the user's form. Transform it.
           this->library_call_args[1] = replace_original_indices_with_transformed_indices(this->library_call_args[1],
                                                                                            this->get_iterators_map());
@@ -3071,12 +3365,38 @@ void computation::create_halide_assignment()
                 tiramisu::expr tiramisu_rhs = replace_original_indices_with_transformed_indices(this->expression,
                                                                                                 this->get_iterators_map());
 
+                // The marker in the index identifies the stores of this
+                // computation in the LLVM module, where they are made
+                // non-temporal.  It is a multiple of 64 elements so that
+                // it does not change the alignment of the stores.
+                if (this->get_function()->should_store_nontemporally(this->get_name()))
+                {
+                    index = index + Halide::Internal::Call::make(index.type(), nontemporal_store_marker(), {},
+                                                                 Halide::Internal::Call::PureExtern) * 64;
+                }
+
                 this->stmt = Halide::Internal::Store::make(
                         buffer_name,
                         generator::halide_expr_from_tiramisu_expr(this->get_function(), this->index_expr, tiramisu_rhs, this),
                         index, param, Halide::Internal::const_true(type.lanes()));
 
                 DEBUG(3, tiramisu::str_dump("Halide::Internal::Store::make statement created."));
+
+                // Updates tagged as atomic only need to be atomic when they
+                // are executed in parallel.
+                if (this->get_function()->should_update_atomically(this->get_name()))
+                {
+                    bool parallel = false;
+                    for (int l = 0; l < this->get_loop_levels_number(); l++)
+                    {
+                        parallel = parallel || this->get_function()->should_parallelize(this->get_name(), l);
+                    }
+                    if (parallel)
+                    {
+                        this->stmt = generator::make_atomic_update(this->stmt, this->get_data_type());
+                    }
+                }
+
             } else if (this->is_library_call()) {
               // We need to make sure to process all of the other arguments for this library call
                 for (int i = 0; i < this->library_call_args.size(); i++) {
@@ -3144,7 +3464,6 @@ void computation::create_halide_assignment()
             }
             // Defines writing into the wait buffer when a transfer is initiated (for nonblocking operations)
             if (this->wait_argument_idx != -1) {
-                ERROR("Nonblocking not currently supported", 0);
                 assert((this->is_recv() || this->is_send_recv()) && "This should be a recv or one-sided operation.");
                 assert(this->wait_access_map && "A wait access map must be provided.");
                 // We treat this like another LHS access, so we'll recompute the LHS access using the req access map.
@@ -3223,7 +3542,6 @@ void computation::create_halide_assignment()
                                                                                                this->get_expr(), this);
             }
             if (this->wait_argument_idx != -1) {
-                ERROR("Nonblocking not currently supported", 0);
                 assert(this->is_send() && "This should be a send operation.");
                 assert(this->wait_access_map && "A request access map must be provided.");
                 // We treat this like another LHS access, so we'll recompute the LHS access using the req access map.
@@ -3950,7 +4268,15 @@ void function::gen_halide_obj(const std::string &obj_file_name, Halide::Target::
                                              Halide::Internal::LoweredFunc::External,
                                              this->get_halide_stmt());
 
-    m.compile(Halide::Outputs().object(obj_file_name));
+    std::vector<std::string> nontemporal_buffers = this->get_nontemporal_buffers();
+    if (nontemporal_buffers.empty())
+    {
+        m.compile(Halide::Outputs().object(obj_file_name));
+    }
+    else
+    {
+        compile_halide_module_with_nontemporal_stores(m, obj_file_name);
+    }
     m.compile(Halide::Outputs().c_header(obj_file_name + ".h"));
 
     if (nvcc_compiler) {
@@ -4101,9 +4427,2311 @@ Halide::Internal::Stmt generator::make_buffer_free(buffer * b) {
                 Halide::Internal::Call::make(Halide::Int(32), "tiramisu_cuda_free",
                                              {Halide::Internal::Variable::make(Halide::type_of<void *>(), b->get_name())}, Halide::Internal::Call::Extern)
         );
+    } else if (b->get_node_shared()) {
+        return Halide::Internal::Evaluate::make(
+                Halide::Internal::Call::make(Halide::Int(32), "tiramisu_MPI_free_node_shared",
+                                             {Halide::Internal::Variable::make(Halide::type_of<void *>(), b->get_name())}, Halide::Internal::Call::Extern)
+        );
     } else {
         return Halide::Internal::Free::make(b->get_name());
     }
 }
 
+namespace
+{
+
+/**
+  * Collect the ranges of the indices used to access a buffer in a
+  * statement.  The indices are bounded over the loops that enclose the
+  * accesses in the statement, so a range is the region of the buffer
+  * accessed by one execution of the statement.  The number of memory
+  * accesses executed by the statement is also estimated.
+  */
+class PrefetchedRegions : public Halide::Internal::IRVisitor
+{
+    using Halide::Internal::IRVisitor::visit;
+
+    Halide::Internal::Scope<Halide::Internal::Interval> loops;
+    int64_t trip_count = 1;
+
+    void add_region(const Halide::Expr &index, Halide::Type t)
+    {
+        Halide::Internal::Interval in = Halide::Internal::bounds_of_expr_in_scope(index, loops);
+        if (!in.is_bounded())
+        {
+            return;
+        }
+
+        in.min = Halide::Internal::simplify(in.min);
+        in.max = Halide::Internal::simplify(in.max);
+        for (const auto &r : regions)
+        {
+            if (Halide::Internal::equal(r.min, in.min) && Halide::Internal::equal(r.max, in.max))
+            {
+                return;
+            }
+        }
+        regions.push_back(in);
+        type = t.element_of();
+    }
+
+    void visit(const Halide::Internal::Load *op)
+    {
+        if (op->name == buffer_name)
+        {
+            add_region(op->index, op->type);
+        }
+        accesses += trip_count;
+        IRVisitor::visit(op);
+    }
+
+    void visit(const Halide::Internal::Store *op)
+    {
+        if (op->name == buffer_name)
+        {
+            add_region(op->index, op->value.type());
+        }
+        accesses += trip_count;
+        IRVisitor::visit(op);
+    }
+
+    void visit(const Halide::Internal::Let *op)
+    {
+        inner_names.insert(op->name);
+        IRVisitor::visit(op);
+    }
+
+    void visit(const Halide::Internal::LetStmt *op)
+    {
+        inner_names.insert(op->name);
+        IRVisitor::visit(op);
+    }
+
+    void visit(const Halide::Internal::For *op)
+    {
+        op->min.accept(this);
+        op->extent.accept(this);
+
+        inner_names.insert(op->name);
+        loops.push(op->name, Halide::Internal::Interval(op->min, op->min + op->extent - 1));
+
+        // Vectorized loops execute their accesses at once.  When the extent
+        // is not known, assume a short loop.
+        int64_t old_trip_count = trip_count;
+        const Halide::Internal::IntImm *extent = op->extent.as<Halide::Internal::IntImm>();
+        if (op->for_type != Halide::Internal::ForType::Vectorized)
+        {
+            trip_count *= extent ? std::max<int64_t>(extent->value, 1) : 16;
+        }
+        op->body.accept(this);
+        trip_count = old_trip_count;
+
+        loops.pop(op->name);
+    }
+
+public:
+    PrefetchedRegions(const std::string &buffer_name) : buffer_name(buffer_name) {}
+
+    const std::string buffer_name;
+
+    /** The regions of the buffer accessed by the statement. */
+    std::vector<Halide::Internal::Interval> regions;
+
+    /** The type of the elements of the buffer. */
+    Halide::Type type;
+
+    /** The names of the loop iterators and of the lets defined in the statement. */
+    std::set<std::string> inner_names;
+
+    /** The estimated number of memory accesses executed by the statement. */
+    int64_t accesses = 0;
+};
+
+}
+
+Halide::Internal::Stmt generator::make_prefetch(const std::string &buffer_name, const std::string &iterator,
+                                                int distance, const Halide::Internal::Stmt &body)
+{
+    DEBUG_FCT_NAME(3);
+    DEBUG_INDENT(4);
+
+    assert(!buffer_name.empty());
+    assert(!iterator.empty());
+    assert(distance >= 0);
+
+    PrefetchedRegions regions(buffer_name);
+    body.accept(&regions);
+
+    if (distance == 0)
+    {
+        // Prefetch far enough so that the memory accesses executed in the
+        // meantime cover the latency of a cache miss.  An access that hits
+        // the cache is assumed to take about one cycle, and a miss about
+        // 200 cycles.
+        const int64_t miss_latency = 200;
+        const int64_t max_distance = 64;
+        int64_t accesses = std::max<int64_t>(regions.accesses, 1);
+        distance = (int) std::min(std::max((miss_latency + accesses - 1) / accesses, (int64_t) 1),
+                                  max_distance);
+        DEBUG(3, tiramisu::str_dump("Estimated number of memory accesses per iteration: " +
+                                    std::to_string(regions.accesses) + ", prefetch distance: " +
+                                    std::to_string(distance)));
+    }
+
+    Halide::Expr ahead = Halide::Internal::Variable::make(
+            halide_type_from_tiramisu_type(global::get_loop_iterator_data_type()), iterator) + distance;
+
+    Halide::Internal::Stmt prefetches;
+    for (const auto &r : regions.regions)
+    {
+        // The region should only depend on the iterators of the enclosing
+        // loops, since the prefetch is inserted before the inner loops and
+        // lets.
+        bool inner = false;
+        for (const auto &name : regions.inner_names)
+        {
+            if (Halide::Internal::expr_uses_var(r.min, name) || Halide::Internal::expr_uses_var(r.max, name))
+            {
+                inner = true;
+            }
+        }
+        if (inner)
+        {
+            DEBUG(3, tiramisu::str_dump("An access to " + buffer_name + " depends on inner loops, it is not prefetched."));
+            continue;
+        }
+
+        Halide::Expr min = Halide::Internal::simplify(Halide::Internal::substitute(iterator, ahead, r.min));
+        Halide::Expr extent = Halide::Internal::simplify(
+                Halide::Internal::substitute(iterator, ahead, r.max) - min + 1);
+        Halide::Internal::Stmt p = Halide::Internal::Evaluate::make(
+                Halide::Internal::Call::make(regions.type, Halide::Internal::Call::prefetch,
+                                             {Halide::Internal::Variable::make(Halide::Handle(), buffer_name),
+                                              min, extent, 1},
+                                             Halide::Internal::Call::Intrinsic));
+        DEBUG(3, tiramisu::str_dump("Prefetch: "); std::cout << p);
+
+        prefetches = prefetches.defined() ? Halide::Internal::Block::make(prefetches, p) : p;
+    }
+
+    DEBUG_INDENT(-4);
+
+    if (!prefetches.defined())
+    {
+        return body;
+    }
+
+    return Halide::Internal::Block::make(prefetches, body);
+}
+
+Halide::Internal::Stmt generator::make_atomic_update(const Halide::Internal::Stmt &s, tiramisu::primitive_t type)
+{
+    DEBUG_FCT_NAME(3);
+    DEBUG_INDENT(4);
+
+    const Halide::Internal::Store *store = s.as<Halide::Internal::Store>();
+    assert(store != NULL);
+
+    std::string op_name;
+    Halide::Expr a, b;
+    if (const Halide::Internal::Add *op = store->value.as<Halide::Internal::Add>())
+    {
+        op_name = "add";
+        a = op->a;
+        b = op->b;
+    }
+    else if (const Halide::Internal::Mul *op = store->value.as<Halide::Internal::Mul>())
+    {
+        op_name = "mul";
+        a = op->a;
+        b = op->b;
+    }
+    else if (const Halide::Internal::Max *op = store->value.as<Halide::Internal::Max>())
+    {
+        op_name = "max";
+        a = op->a;
+        b = op->b;
+    }
+    else if (const Halide::Internal::Min *op = store->value.as<Halide::Internal::Min>())
+    {
+        op_name = "min";
+        a = op->a;
+        b = op->b;
+    }
+    else
+    {
+        ERROR("The update of " + store->name + " cannot be made atomic, it is not a +, *, max or min.", true);
+    }
+
+    // One operand should read the element that is updated.
+    auto reads_updated_element = [store](const Halide::Expr &e) {
+        const Halide::Internal::Load *load = e.as<Halide::Internal::Load>();
+        return (load != NULL) && (load->name == store->name) &&
+               Halide::Internal::is_zero(Halide::Internal::simplify(load->index - store->index));
+    };
+    Halide::Expr value;
+    if (reads_updated_element(a))
+    {
+        value = b;
+    }
+    else if (reads_updated_element(b))
+    {
+        value = a;
+    }
+    else
+    {
+        ERROR("The update of " + store->name + " cannot be made atomic, it does not read the updated element.", true);
+    }
+
+    // The index argument is 64-bit, whatever the type of the loop
+    // iterators (see global::set_loop_iterator_type()).
+    std::string fct_name = "tiramisu_atomic_" + op_name + "_" + str_from_tiramisu_type_primitive(type);
+    Halide::Internal::Stmt result = Halide::Internal::Evaluate::make(
+            Halide::Internal::Call::make(Halide::Int(32), fct_name,
+                                         {Halide::Internal::Variable::make(Halide::Handle(), store->name),
+                                          Halide::cast(Halide::Int(64), store->index), value},
+                                         Halide::Internal::Call::Extern));
+
+    DEBUG(3, tiramisu::str_dump("Atomic update: "); std::cout << result);
+
+    DEBUG_INDENT(-4);
+
+    return result;
+}
+
+namespace
+{
+
+/**
+  * Return true if a statement stores into a given buffer.
+  */
+class StoresInto : public Halide::Internal::IRVisitor
+{
+    using Halide::Internal::IRVisitor::visit;
+
+    const std::string &buffer_name;
+
+    void visit(const Halide::Internal::Store *op)
+    {
+        found = found || (op->name == buffer_name);
+        Halide::Internal::IRVisitor::visit(op);
+    }
+
+public:
+    bool found = false;
+
+    StoresInto(const std::string &buffer_name) : buffer_name(buffer_name) {}
+};
+
+/**
+  * Wrap the body of the outermost loops that store into a given buffer
+  * with the synchronization of a pipelined wavefront.
+  */
+class SynchronizeWavefront : public Halide::Internal::IRMutator
+{
+    using Halide::Internal::IRMutator::visit;
+
+    const std::string &buffer_name;
+    const std::vector<std::pair<int, int>> &lags;
+    Halide::Expr flags, row;
+
+    void visit(const Halide::Internal::For *op)
+    {
+        StoresInto stores(buffer_name);
+        op->body.accept(&stores);
+        if (!stores.found)
+        {
+            stmt = op;
+            return;
+        }
+
+        Halide::Expr column = Halide::Internal::Variable::make(op->min.type(), op->name);
+        Halide::Internal::Stmt body = op->body;
+        for (const auto &lag : lags)
+        {
+            Halide::Internal::Stmt wait = Halide::Internal::Evaluate::make(
+                    Halide::Internal::Call::make(Halide::Int(32), "tiramisu_wavefront_wait",
+                                                 {flags, Halide::cast(Halide::Int(32), row - lag.first),
+                                                  Halide::cast(Halide::Int(32), column + lag.second)},
+                                                 Halide::Internal::Call::Extern));
+            body = Halide::Internal::Block::make(
+                    Halide::Internal::IfThenElse::make(row >= lag.first, wait), body);
+        }
+        Halide::Internal::Stmt signal = Halide::Internal::Evaluate::make(
+                Halide::Internal::Call::make(Halide::Int(32), "tiramisu_wavefront_signal",
+                                             {flags, Halide::cast(Halide::Int(32), row), Halide::cast(Halide::Int(32), column)},
+                                             Halide::Internal::Call::Extern));
+        body = Halide::Internal::Block::make(body, signal);
+
+        stmt = Halide::Internal::For::make(op->name, op->min, op->extent, op->for_type, op->device_api, body);
+    }
+
+public:
+    SynchronizeWavefront(const std::string &buffer_name, const std::vector<std::pair<int, int>> &lags,
+                         Halide::Expr flags, Halide::Expr row)
+        : buffer_name(buffer_name), lags(lags), flags(flags), row(row) {}
+};
+
+}
+
+Halide::Internal::Stmt generator::make_wavefront_pipeline(const Halide::Internal::Stmt &loop,
+                                                          const std::string &buffer_name,
+                                                          const std::vector<std::pair<int, int>> &lags)
+{
+    DEBUG_FCT_NAME(3);
+    DEBUG_INDENT(4);
+
+    const Halide::Internal::For *op = loop.as<Halide::Internal::For>();
+    assert(op != NULL);
+
+    // One flag per iteration of the parallel loop: the last iteration of the
+    // inner loop that is done (INT_MIN before the first one, INT_MAX after
+    // the last one).
+    std::string flags_name = op->name + "_wavefront_flags";
+    Halide::Expr flags = Halide::Internal::Variable::make(Halide::Handle(), flags_name);
+    Halide::Expr row = Halide::Internal::Variable::make(op->min.type(), op->name) - op->min;
+
+    Halide::Internal::Stmt body = SynchronizeWavefront(buffer_name, lags, flags, row).mutate(op->body);
+    body = Halide::Internal::Block::make(
+            body, Halide::Internal::Evaluate::make(
+                    Halide::Internal::Call::make(Halide::Int(32), "tiramisu_wavefront_signal",
+                                                 {flags, Halide::cast(Halide::Int(32), row), Halide::Int(32).max()},
+                                                 Halide::Internal::Call::Extern)));
+    Halide::Internal::Stmt result = Halide::Internal::For::make(op->name, op->min, op->extent,
+                                                                op->for_type, op->device_api, body);
+
+    std::string init_iter = flags_name + "_init";
+    Halide::Internal::Stmt init = Halide::Internal::For::make(
+            init_iter, Halide::Internal::make_zero(op->extent.type()), op->extent,
+            Halide::Internal::ForType::Serial, Halide::DeviceAPI::Host,
+            Halide::Internal::Store::make(flags_name, Halide::Int(32).min(),
+                                          Halide::Internal::Variable::make(op->extent.type(), init_iter),
+                                          Halide::Internal::Parameter(), Halide::Internal::const_true()));
+    result = Halide::Internal::Allocate::make(flags_name, Halide::Int(32), {op->extent},
+                                              Halide::Internal::const_true(),
+                                              Halide::Internal::Block::make(init, result));
+
+    DEBUG(3, tiramisu::str_dump("Pipelined wavefront: "); std::cout << result);
+
+    DEBUG_INDENT(-4);
+
+    return result;
+}
+
+Halide::Internal::Stmt generator::make_collapsed_loop(const Halide::Internal::Stmt &loop, int n)
+{
+    DEBUG_FCT_NAME(3);
+    DEBUG_INDENT(4);
+
+    assert(n >= 2);
+
+    // The loops to collapse, from the outermost to the innermost.
+    std::vector<const Halide::Internal::For *> loops;
+    loops.push_back(loop.as<Halide::Internal::For>());
+    assert(loops[0] != NULL);
+    for (int i = 1; i < n; i++)
+    {
+        const Halide::Internal::For *inner = loops.back()->body.as<Halide::Internal::For>();
+        bool collapsible = (inner != NULL) && (inner->for_type == Halide::Internal::ForType::Serial);
+        for (int j = 0; collapsible && (j < (int) loops.size()); j++)
+        {
+            collapsible = !Halide::Internal::expr_uses_var(inner->min, loops[j]->name) &&
+                          !Halide::Internal::expr_uses_var(inner->extent, loops[j]->name);
+        }
+        if (!collapsible)
+        {
+            DEBUG(3, tiramisu::str_dump("The loops nested in " + loops[0]->name +
+                                        " cannot be collapsed (not perfectly nested, not serial or not rectangular)."));
+            DEBUG_INDENT(-4);
+            return loop;
+        }
+        loops.push_back(inner);
+    }
+
+    std::string name = loops[0]->name + "_collapsed";
+    Halide::Type t = loops[0]->min.type();
+    Halide::Expr iterator = Halide::Internal::Variable::make(t, name);
+
+    // Recover the iterators of the original loops, from the innermost one.
+    Halide::Internal::Stmt body = loops.back()->body;
+    Halide::Expr stride = Halide::Internal::make_one(t);
+    for (int i = n - 1; i >= 0; i--)
+    {
+        Halide::Expr extent = Halide::cast(t, loops[i]->extent);
+        Halide::Expr index = (i == n - 1) ? iterator : iterator / stride;
+        if (i > 0)
+        {
+            index = index % extent;
+        }
+        body = Halide::Internal::LetStmt::make(loops[i]->name, Halide::cast(t, loops[i]->min) + index, body);
+        stride = Halide::Internal::simplify(stride * extent);
+    }
+
+    Halide::Internal::Stmt result = Halide::Internal::For::make(name, Halide::Internal::make_zero(t), stride,
+                                                                loops[0]->for_type, loops[0]->device_api, body);
+
+    DEBUG(3, tiramisu::str_dump("Collapsed loop: "); std::cout << result);
+
+    DEBUG_INDENT(-4);
+
+    return result;
+}
+
+namespace
+{
+
+/**
+  * Replace the outermost parallel loops of a statement with the result of
+  * \p schedule.
+  */
+class ScheduleParallelLoops : public Halide::Internal::IRMutator
+{
+    using Halide::Internal::IRMutator::visit;
+
+    std::function<Halide::Internal::Stmt(const Halide::Internal::Stmt &)> schedule;
+
+    void visit(const Halide::Internal::For *op)
+    {
+        if (op->for_type == Halide::Internal::ForType::Parallel)
+        {
+            stmt = schedule(op);
+        }
+        else
+        {
+            Halide::Internal::IRMutator::visit(op);
+        }
+    }
+
+public:
+    ScheduleParallelLoops(std::function<Halide::Internal::Stmt(const Halide::Internal::Stmt &)> schedule)
+        : schedule(schedule) {}
+};
+
+}
+
+Halide::Internal::Stmt generator::make_parallel_schedule(const Halide::Internal::Stmt &loop,
+                                                         tiramisu::parallel_schedule_t policy,
+                                                         int chunk_size)
+{
+    DEBUG_FCT_NAME(3);
+    DEBUG_INDENT(4);
+
+    const Halide::Internal::For *op = loop.as<Halide::Internal::For>();
+    if ((op == NULL) || (op->for_type != Halide::Internal::ForType::Parallel))
+    {
+        Halide::Internal::Stmt result = ScheduleParallelLoops([&](const Halide::Internal::Stmt &l) {
+            return make_parallel_schedule(l, policy, chunk_size);
+        }).mutate(loop);
+        DEBUG_INDENT(-4);
+        return result;
+    }
+
+    Halide::Type t = op->min.type();
+    Halide::Expr extent = Halide::cast(t, op->extent);
+    std::string threads_name = op->name + "_threads";
+    std::string chunk_name = op->name + "_chunk";
+    Halide::Expr threads = Halide::Internal::Variable::make(t, threads_name);
+    Halide::Expr chunk = Halide::Internal::Variable::make(t, chunk_name);
+
+    // The iterations of a chunk are executed by a serial loop that keeps
+    // the name (and thus the body) of the original loop.
+    auto make_chunk = [&](Halide::Expr begin, Halide::Expr size) {
+        return Halide::Internal::For::make(op->name, op->min + begin, size,
+                                           Halide::Internal::ForType::Serial, op->device_api, op->body);
+    };
+
+    Halide::Internal::Stmt result;
+    if (policy == tiramisu::s_static)
+    {
+        // Thread w executes the chunks w, w + threads, w + 2*threads, ...
+        Halide::Expr size = (chunk_size > 0) ? Halide::cast(t, chunk_size) : (extent + threads - 1) / threads;
+        Halide::Expr n_chunks = (extent + size - 1) / size;
+        std::string worker_name = op->name + "_worker";
+        std::string round_name = op->name + "_round";
+        Halide::Expr worker = Halide::Internal::Variable::make(t, worker_name);
+        Halide::Expr round = Halide::Internal::Variable::make(t, round_name);
+        Halide::Expr begin = (worker + round * threads) * size;
+        result = make_chunk(begin, Halide::min(size, extent - begin));
+        result = Halide::Internal::For::make(round_name, Halide::Internal::make_zero(t),
+                                             (n_chunks - worker + threads - 1) / threads,
+                                             Halide::Internal::ForType::Serial, op->device_api, result);
+        result = Halide::Internal::For::make(worker_name, Halide::Internal::make_zero(t), threads,
+                                             Halide::Internal::ForType::Parallel, op->device_api, result);
+    }
+    else if (policy == tiramisu::s_dynamic)
+    {
+        // The runtime hands the chunks to the threads as they become idle.
+        Halide::Expr size = Halide::cast(t, std::max(chunk_size, 1));
+        Halide::Expr begin = chunk * size;
+        result = make_chunk(begin, Halide::min(size, extent - begin));
+        result = Halide::Internal::For::make(chunk_name, Halide::Internal::make_zero(t), (extent + size - 1) / size,
+                                             Halide::Internal::ForType::Parallel, op->device_api, result);
+    }
+    else
+    {
+        assert(policy == tiramisu::s_guided);
+
+        // The chunks are taken in order from a shared cursor, so the large
+        // chunks are executed first and the small ones balance the end of
+        // the loop.  Each iteration of the parallel loop takes one chunk.
+        Halide::Expr size = Halide::cast(Halide::Int(32), std::max(chunk_size, 1));
+        Halide::Expr extent32 = Halide::cast(Halide::Int(32), extent);
+        Halide::Expr threads32 = Halide::cast(Halide::Int(32), threads);
+        std::string cursor_name = op->name + "_guided_cursor";
+        Halide::Expr cursor = Halide::Internal::Variable::make(Halide::Handle(), cursor_name);
+        std::string begin_name = op->name + "_begin";
+        Halide::Expr begin = Halide::Internal::Variable::make(t, begin_name);
+        Halide::Expr remaining = extent - begin;
+        result = make_chunk(begin, Halide::min(Halide::max((remaining + threads - 1) / threads,
+                                                           Halide::cast(t, size)),
+                                               remaining));
+        result = Halide::Internal::LetStmt::make(
+                begin_name,
+                Halide::cast(t, Halide::Internal::Call::make(Halide::Int(32), "tiramisu_guided_chunk_next",
+                                                             {cursor, extent32, threads32, size},
+                                                             Halide::Internal::Call::Extern)),
+                result);
+        Halide::Expr n_chunks = Halide::cast(t, Halide::Internal::Call::make(
+                Halide::Int(32), "tiramisu_guided_chunk_count", {extent32, threads32, size},
+                Halide::Internal::Call::Extern));
+        result = Halide::Internal::For::make(chunk_name, Halide::Internal::make_zero(t), n_chunks,
+                                             Halide::Internal::ForType::Parallel, op->device_api, result);
+        result = Halide::Internal::Allocate::make(
+                cursor_name, Halide::Int(32), {1}, Halide::Internal::const_true(),
+                Halide::Internal::Block::make(
+                        Halide::Internal::Store::make(cursor_name, 0, 0, Halide::Internal::Parameter(),
+                                                      Halide::Internal::const_true()),
+                        result));
+    }
+
+    result = Halide::Internal::LetStmt::make(
+            threads_name,
+            Halide::cast(t, Halide::Internal::Call::make(Halide::Int(32), "tiramisu_parallel_num_threads", {},
+                                                         Halide::Internal::Call::Extern)),
+            result);
+
+    DEBUG(3, tiramisu::str_dump("Scheduled parallel loop: "); std::cout << result);
+
+    DEBUG_INDENT(-4);
+
+    return result;
+}
+
+Halide::Internal::Stmt generator::make_distributed_loop(const Halide::Internal::Stmt &loop,
+                                                        tiramisu::distribution_t policy, int block_size,
+                                                        const std::vector<int> &weights)
+{
+    DEBUG_FCT_NAME(3);
+    DEBUG_INDENT(4);
+
+    const Halide::Internal::For *op = loop.as<Halide::Internal::For>();
+    assert(op != NULL);
+    assert(!weights.empty());
+
+    Halide::Type t = op->min.type();
+    Halide::Expr extent = Halide::cast(t, op->extent);
+    Halide::Expr rank = Halide::Internal::Variable::make(t, "rank");
+    Halide::Expr ranks = Halide::cast(t, (int) weights.size());
+
+    // The iterations [begin, end) are executed by a serial loop that keeps
+    // the name (and thus the body) of the original loop.
+    auto make_range = [&](Halide::Expr begin, Halide::Expr end) {
+        return Halide::Internal::For::make(op->name, op->min + begin, Halide::max(end - begin, 0),
+                                           Halide::Internal::ForType::Serial, op->device_api, op->body);
+    };
+
+    Halide::Internal::Stmt result;
+    if (policy == tiramisu::d_block)
+    {
+        Halide::Expr size = (extent + ranks - 1) / ranks;
+        Halide::Expr begin = Halide::min(rank * size, extent);
+        result = make_range(begin, Halide::min(begin + size, extent));
+    }
+    else if ((policy == tiramisu::d_cyclic) || (policy == tiramisu::d_block_cyclic))
+    {
+        // The rank executes the blocks rank, rank + ranks, rank + 2*ranks, ...
+        assert(block_size > 0);
+        Halide::Expr size = Halide::cast(t, block_size);
+        Halide::Expr n_blocks = (extent + size - 1) / size;
+        std::string round_name = op->name + "_round";
+        Halide::Expr round = Halide::Internal::Variable::make(t, round_name);
+        Halide::Expr begin = (rank + round * ranks) * size;
+        result = make_range(begin, Halide::min(begin + size, extent));
+        result = Halide::Internal::For::make(round_name, Halide::Internal::make_zero(t),
+                                             Halide::max((n_blocks - rank + ranks - 1) / ranks, 0),
+                                             Halide::Internal::ForType::Serial, op->device_api, result);
+        result = Halide::Internal::IfThenElse::make(rank < ranks, result);
+    }
+    else
+    {
+        assert(policy == tiramisu::d_weighted);
+
+        // The rank r executes [extent * W(r) / W, extent * W(r + 1) / W),
+        // W(r) being the sum of the weights of the ranks before r.  The ranks
+        // beyond the last weight execute nothing.
+        std::vector<int> prefix(1, 0);
+        for (int w : weights)
+        {
+            prefix.push_back(prefix.back() + w);
+        }
+        auto prefix_of = [&](Halide::Expr r) {
+            Halide::Expr p = Halide::cast(Halide::Int(64), prefix.back());
+            for (int i = (int) prefix.size() - 2; i >= 0; i--)
+            {
+                p = Halide::select(r <= i, Halide::cast(Halide::Int(64), prefix[i]), p);
+            }
+            return p;
+        };
+        assert((prefix.back() > 0) && "The weights of a weighted distribution should not all be zero.");
+        Halide::Expr total = Halide::cast(Halide::Int(64), prefix.back());
+        Halide::Expr extent64 = Halide::cast(Halide::Int(64), extent);
+        result = make_range(Halide::cast(t, extent64 * prefix_of(rank) / total),
+                            Halide::cast(t, extent64 * prefix_of(rank + 1) / total));
+    }
+
+    DEBUG(3, tiramisu::str_dump("Distributed loop: "); std::cout << result);
+
+    DEBUG_INDENT(-4);
+
+    return result;
+}
+
+bool generator::get_task_accesses(const tiramisu::function &fct, isl_ast_node *node,
+                                  std::set<std::string> &reads, std::set<std::string> &writes)
+{
+    if (isl_ast_node_get_type(node) == isl_ast_node_block)
+    {
+        isl_ast_node_list *list = isl_ast_node_block_get_children(node);
+        bool is_task = true;
+        for (int i = 0; is_task && (i < isl_ast_node_list_n_ast_node(list)); i++)
+        {
+            isl_ast_node *child = isl_ast_node_list_get_ast_node(list, i);
+            is_task = generator::get_task_accesses(fct, child, reads, writes);
+            isl_ast_node_free(child);
+        }
+        isl_ast_node_list_free(list);
+        return is_task;
+    }
+    else if (isl_ast_node_get_type(node) == isl_ast_node_for)
+    {
+        isl_ast_node *body = isl_ast_node_for_get_body(node);
+        bool is_task = generator::get_task_accesses(fct, body, reads, writes);
+        isl_ast_node_free(body);
+        return is_task;
+    }
+    else if (isl_ast_node_get_type(node) == isl_ast_node_if)
+    {
+        isl_ast_node *then_node = isl_ast_node_if_get_then(node);
+        isl_ast_node *else_node = isl_ast_node_if_get_else(node);
+        bool is_task = generator::get_task_accesses(fct, then_node, reads, writes) &&
+                       ((else_node == NULL) || generator::get_task_accesses(fct, else_node, reads, writes));
+        isl_ast_node_free(then_node);
+        isl_ast_node_free(else_node);
+        return is_task;
+    }
+    else if (isl_ast_node_get_type(node) == isl_ast_node_user)
+    {
+        tiramisu::computation *comp = get_computation_annotated_in_a_node(node);
+        if (!fct.should_run_as_task(comp->get_name()) || (comp->get_buffer() == nullptr) ||
+            comp->is_send() || comp->is_recv() || comp->is_wait() || comp->is_collective())
+        {
+            return false;
+        }
+        writes.insert(comp->get_buffer()->get_name());
+
+        // The buffers of the computations accessed by comp.  A
+        // computation that is not mapped to a buffer is identified by its
+        // name.
+        std::vector<isl_map *> accesses;
+        generator::get_rhs_accesses(&fct, comp, accesses, false);
+        for (auto access : accesses)
+        {
+            std::string name = isl_map_get_tuple_name(access, isl_dim_out);
+            const auto &accessed = fct.get_computation_by_name(name);
+            if (!accessed.empty() && (accessed[0]->get_buffer() != nullptr))
+            {
+                name = accessed[0]->get_buffer()->get_name();
+            }
+            reads.insert(name);
+            isl_map_free(access);
+        }
+        return true;
+    }
+
+    return false;
+}
+
+Halide::Internal::Stmt generator::make_task_parallel_block(const std::vector<Halide::Internal::Stmt> &tasks)
+{
+    DEBUG_FCT_NAME(3);
+    DEBUG_INDENT(4);
+
+    assert(tasks.size() > 1);
+
+    // Each iteration of the parallel loop executes one task.
+    std::string task_name = Halide::Internal::unique_name("_task");
+    Halide::Expr task = Halide::Internal::Variable::make(Halide::Int(32), task_name);
+
+    Halide::Internal::Stmt body = tasks.back();
+    for (int i = (int) tasks.size() - 2; i >= 0; i--)
+    {
+        body = Halide::Internal::IfThenElse::make(task == i, tasks[i], body);
+    }
+    Halide::Internal::Stmt result = Halide::Internal::For::make(task_name, 0, (int) tasks.size(),
+                                                                Halide::Internal::ForType::Parallel,
+                                                                Halide::DeviceAPI::Host, body);
+
+    DEBUG(3, tiramisu::str_dump("Task parallel block: "); std::cout << result);
+
+    DEBUG_INDENT(-4);
+
+    return result;
+}
+
+namespace
+{
+
+/**
+  * Collect the loads and the stores of a loop body that are executed
+  * unconditionally, and the names that are used and defined in it.
+  */
+class BufferAccesses : public Halide::Internal::IRVisitor
+{
+    using Halide::Internal::IRVisitor::visit;
+
+    int conditionals = 0;
+
+    void visit(const Halide::Internal::Load *op)
+    {
+        loads.push_back(std::make_pair(op, conditionals == 0));
+        Halide::Internal::IRVisitor::visit(op);
+    }
+
+    void visit(const Halide::Internal::Store *op)
+    {
+        stores.push_back(std::make_pair(op, conditionals == 0));
+        Halide::Internal::IRVisitor::visit(op);
+    }
+
+    void visit(const Halide::Internal::IfThenElse *op)
+    {
+        op->condition.accept(this);
+        conditionals++;
+        op->then_case.accept(this);
+        if (op->else_case.defined())
+        {
+            op->else_case.accept(this);
+        }
+        conditionals--;
+    }
+
+    void visit(const Halide::Internal::Select *op)
+    {
+        op->condition.accept(this);
+        conditionals++;
+        op->true_value.accept(this);
+        op->false_value.accept(this);
+        conditionals--;
+    }
+
+    void visit(const Halide::Internal::Variable *op)
+    {
+        variables.insert(op->name);
+    }
+
+    void visit(const Halide::Internal::LetStmt *op)
+    {
+        defined.insert(op->name);
+        Halide::Internal::IRVisitor::visit(op);
+    }
+
+    void visit(const Halide::Internal::Let *op)
+    {
+        defined.insert(op->name);
+        Halide::Internal::IRVisitor::visit(op);
+    }
+
+    void visit(const Halide::Internal::For *op)
+    {
+        defined.insert(op->name);
+        Halide::Internal::IRVisitor::visit(op);
+    }
+
+public:
+    // Each access is paired with true if it is executed unconditionally.
+    std::vector<std::pair<const Halide::Internal::Load *, bool>> loads;
+    std::vector<std::pair<const Halide::Internal::Store *, bool>> stores;
+    std::set<std::string> variables, defined;
+};
+
+/**
+  * Return true if the buffer indices \p a and \p b are always equal.
+  */
+bool same_index(const Halide::Expr &a, const Halide::Expr &b)
+{
+    return (a.type() == b.type()) && Halide::Internal::is_zero(Halide::Internal::simplify(a - b));
+}
+
+/**
+  * An element (or a vector of elements) of the buffer \p buffer_name,
+  * at the index \p index, kept in the register \p register_name.
+  */
+struct PromotedAccess
+{
+    std::string buffer_name;
+    Halide::Expr index;
+    Halide::Type type;
+    Halide::Buffer<> image;
+    Halide::Internal::Parameter param;
+    std::string register_name;
+    bool stored;
+
+    Halide::Expr register_index() const
+    {
+        return (type.lanes() == 1) ? Halide::Expr(0) : Halide::Internal::Ramp::make(0, 1, type.lanes());
+    }
+
+    Halide::Expr load_register() const
+    {
+        return Halide::Internal::Load::make(type, register_name, register_index(), Halide::Buffer<>(),
+                                            Halide::Internal::Parameter(), Halide::Internal::const_true(type.lanes()));
+    }
+
+    Halide::Internal::Stmt store_register(Halide::Expr value) const
+    {
+        return Halide::Internal::Store::make(register_name, value, register_index(), Halide::Internal::Parameter(),
+                                             Halide::Internal::const_true(type.lanes()));
+    }
+};
+
+/**
+  * Return true if the elements accessed by \p a and \p b provably do not
+  * overlap.  Only scalar and dense vector accesses, whose first elements
+  * are a constant distance apart, are known not to overlap.
+  */
+bool disjoint_accesses(const PromotedAccess &a, const PromotedAccess &b)
+{
+    auto first_element = [](const PromotedAccess &p) {
+        if (p.type.lanes() == 1)
+        {
+            return p.index;
+        }
+        const Halide::Internal::Ramp *ramp = p.index.as<Halide::Internal::Ramp>();
+        return ((ramp != NULL) && Halide::Internal::is_one(ramp->stride)) ? ramp->base : Halide::Expr();
+    };
+
+    Halide::Expr a_first = first_element(a);
+    Halide::Expr b_first = first_element(b);
+    if (!a_first.defined() || !b_first.defined() || (a_first.type() != b_first.type()))
+    {
+        return false;
+    }
+    const int64_t *distance = Halide::Internal::as_const_int(Halide::Internal::simplify(a_first - b_first));
+    return (distance != NULL) && ((*distance >= b.type.lanes()) || (-*distance >= a.type.lanes()));
+}
+
+/**
+  * Replace the promoted accesses by accesses to their registers.
+  */
+class ReplacePromotedAccesses : public Halide::Internal::IRMutator
+{
+    using Halide::Internal::IRMutator::visit;
+
+    const std::vector<PromotedAccess> &promoted;
+
+    const PromotedAccess *find(const std::string &name, const Halide::Expr &index)
+    {
+        for (const auto &p : promoted)
+        {
+            if ((p.buffer_name == name) && same_index(p.index, index))
+            {
+                return &p;
+            }
+        }
+        return NULL;
+    }
+
+    void visit(const Halide::Internal::Load *op)
+    {
+        const PromotedAccess *p = find(op->name, op->index);
+        if (p == NULL)
+        {
+            Halide::Internal::IRMutator::visit(op);
+            return;
+        }
+        expr = p->load_register();
+    }
+
+    void visit(const Halide::Internal::Store *op)
+    {
+        const PromotedAccess *p = find(op->name, op->index);
+        if (p == NULL)
+        {
+            Halide::Internal::IRMutator::visit(op);
+            return;
+        }
+        stmt = p->store_register(mutate(op->value));
+    }
+
+public:
+    ReplacePromotedAccesses(const std::vector<PromotedAccess> &promoted) : promoted(promoted) {}
+};
+
+/**
+  * Promote the accesses of \p loop that do not depend on the loop to
+  * registers: the elements are loaded into registers before the loop,
+  * and the elements that are stored in the loop (e.g., the accumulators
+  * of a reduction) are stored back after it.  A buffer is only promoted
+  * if all its accesses in the loop are unconditional accesses to the
+  * promoted elements, and if its promoted elements provably do not
+  * overlap (so the registers cannot be aliased).
+  */
+Halide::Internal::Stmt promote_to_registers(const Halide::Internal::For *loop)
+{
+    BufferAccesses accesses;
+    loop->body.accept(&accesses);
+    accesses.defined.insert(loop->name);
+
+    auto is_invariant = [&](const Halide::Expr &index) {
+        for (const auto &name : accesses.defined)
+        {
+            if (Halide::Internal::expr_uses_var(index, name))
+            {
+                return false;
+            }
+        }
+        return true;
+    };
+    auto find = [](std::vector<PromotedAccess> &promoted, const std::string &name, const Halide::Expr &index) {
+        for (auto &p : promoted)
+        {
+            if ((p.buffer_name == name) && same_index(p.index, index))
+            {
+                return &p;
+            }
+        }
+        return (PromotedAccess *) NULL;
+    };
+
+    // The candidates, and the buffers that cannot be promoted.
+    std::vector<PromotedAccess> candidates;
+    std::set<std::string> rejected;
+    auto add_candidate = [&](const std::string &name, const Halide::Expr &index, Halide::Type type,
+                             const Halide::Expr &predicate, bool unconditional,
+                             const Halide::Buffer<> &image, const Halide::Internal::Parameter &param, bool stored) {
+        if (!unconditional || !Halide::Internal::is_one(predicate) || !is_invariant(index) ||
+            accesses.variables.count(name) || accesses.variables.count(name + ".buffer"))
+        {
+            rejected.insert(name);
+            return;
+        }
+        PromotedAccess *p = find(candidates, name, index);
+        if (p == NULL)
+        {
+            candidates.push_back({name, index, type, image, param,
+                                  name + "_reg_" + std::to_string(candidates.size()), stored});
+        }
+        else if (p->type != type)
+        {
+            rejected.insert(name);
+        }
+        else
+        {
+            p->stored = p->stored || stored;
+            if (!p->image.defined() && !p->param.defined())
+            {
+                p->image = image;
+                p->param = param;
+            }
+        }
+    };
+    for (const auto &s : accesses.stores)
+    {
+        add_candidate(s.first->name, s.first->index, s.first->value.type(), s.first->predicate, s.second,
+                      Halide::Buffer<>(), s.first->param, true);
+    }
+    for (const auto &l : accesses.loads)
+    {
+        add_candidate(l.first->name, l.first->index, l.first->type, l.first->predicate, l.second,
+                      l.first->image, l.first->param, false);
+    }
+
+    // The elements of a buffer are promoted to different registers, so
+    // they must not overlap.
+    for (size_t a = 0; a < candidates.size(); a++)
+    {
+        for (size_t b = a + 1; b < candidates.size(); b++)
+        {
+            if ((candidates[a].buffer_name == candidates[b].buffer_name) &&
+                !disjoint_accesses(candidates[a], candidates[b]))
+            {
+                rejected.insert(candidates[a].buffer_name);
+            }
+        }
+    }
+
+    std::vector<PromotedAccess> promoted;
+    for (const auto &p : candidates)
+    {
+        if (!rejected.count(p.buffer_name))
+        {
+            promoted.push_back(p);
+        }
+    }
+
+    Halide::Internal::Stmt result = loop;
+    if (promoted.empty())
+    {
+        return result;
+    }
+
+    result = Halide::Internal::For::make(loop->name, loop->min, loop->extent, loop->for_type, loop->device_api,
+                                         ReplacePromotedAccesses(promoted).mutate(loop->body));
+    for (const auto &p : promoted)
+    {
+        DEBUG(3, tiramisu::str_dump("Promotion of " + p.buffer_name + "[");
+                 std::cout << p.index << "] to a register");
+        Halide::Expr value = Halide::Internal::Load::make(p.type, p.buffer_name, p.index, p.image, p.param,
+                                                          Halide::Internal::const_true(p.type.lanes()));
+        result = Halide::Internal::Block::make(p.store_register(value), result);
+        if (p.stored)
+        {
+            result = Halide::Internal::Block::make(
+                    result, Halide::Internal::Store::make(p.buffer_name, p.load_register(), p.index, p.param,
+                                                          Halide::Internal::const_true(p.type.lanes())));
+        }
+        result = Halide::Internal::Allocate::make(p.register_name, p.type.element_of(), {p.type.lanes()},
+                                                  Halide::Internal::const_true(), result);
+    }
+
+    // The promoted elements are only accessed if the loop is executed.
+    return Halide::Internal::IfThenElse::make(loop->extent > 0, result);
+}
+
+}
+
+Halide::Internal::Stmt generator::make_unroll_and_jam(const Halide::Internal::Stmt &loop, int factor)
+{
+    DEBUG_FCT_NAME(3);
+    DEBUG_INDENT(4);
+
+    assert(factor > 1);
+
+    const Halide::Internal::For *op = loop.as<Halide::Internal::For>();
+    assert(op != NULL);
+
+    // The loops perfectly nested in op, from the outermost to the innermost.
+    std::vector<const Halide::Internal::For *> inner;
+    Halide::Internal::Stmt body = op->body;
+    while (const Halide::Internal::For *l = body.as<Halide::Internal::For>())
+    {
+        if (Halide::Internal::expr_uses_var(l->min, op->name) || Halide::Internal::expr_uses_var(l->extent, op->name))
+        {
+            DEBUG(3, tiramisu::str_dump("The loop " + op->name + " cannot be unrolled and jammed (the bounds of " +
+                                        l->name + " depend on it)."));
+            DEBUG_INDENT(-4);
+            return loop;
+        }
+        inner.push_back(l);
+        body = l->body;
+    }
+
+    Halide::Type t = op->min.type();
+    std::string outer_name = op->name + "_jam";
+    Halide::Expr base = op->min + Halide::Internal::Variable::make(t, outer_name) * factor;
+    Halide::Expr n_full = Halide::cast(t, op->extent) / factor;
+
+    // The copies of the body for the iterations base, ..., base + factor - 1.
+    std::vector<Halide::Internal::Stmt> copies;
+    for (int u = 0; u < factor; u++)
+    {
+        copies.push_back(Halide::Internal::substitute(op->name, base + u, body));
+    }
+    Halide::Internal::Stmt jammed = Halide::Internal::Block::make(copies);
+
+    for (int i = (int) inner.size() - 1; i >= 0; i--)
+    {
+        jammed = Halide::Internal::For::make(inner[i]->name, inner[i]->min, inner[i]->extent,
+                                             inner[i]->for_type, inner[i]->device_api, jammed);
+        if (i == (int) inner.size() - 1)
+        {
+            jammed = promote_to_registers(jammed.as<Halide::Internal::For>());
+        }
+    }
+
+    Halide::Internal::Stmt full = Halide::Internal::For::make(outer_name, Halide::Internal::make_zero(t), n_full,
+                                                              op->for_type, op->device_api, jammed);
+    Halide::Internal::Stmt remainder = Halide::Internal::For::make(op->name, op->min + n_full * factor,
+                                                                   Halide::cast(t, op->extent) - n_full * factor,
+                                                                   op->for_type, op->device_api, op->body);
+    Halide::Internal::Stmt result = Halide::Internal::Block::make(full, remainder);
+
+    DEBUG(3, tiramisu::str_dump("Unrolled and jammed loop: "); std::cout << result);
+
+    DEBUG_INDENT(-4);
+
+    return result;
+}
+
+Halide::Internal::Stmt generator::make_register_promotion(const Halide::Internal::Stmt &loop)
+{
+    DEBUG_FCT_NAME(3);
+    DEBUG_INDENT(4);
+
+    const Halide::Internal::For *op = loop.as<Halide::Internal::For>();
+    assert(op != NULL);
+
+    Halide::Internal::Stmt result = promote_to_registers(op);
+
+    DEBUG(10, tiramisu::str_dump("Loop after register promotion: "); std::cout << result);
+
+    DEBUG_INDENT(-4);
+
+    return result;
+}
+
+namespace
+{
+
+/**
+  * Add a mask to the predicates of the loads and the stores of a
+  * statement.  The conditions of the IfThenElse statements without an
+  * else case are folded into the mask.  \p supported is set to false if
+  * the statement contains a construct that cannot be predicated.
+  */
+class PredicateAccesses : public Halide::Internal::IRMutator
+{
+    using Halide::Internal::IRMutator::visit;
+
+    Halide::Expr mask;
+
+    void visit(const Halide::Internal::Load *op)
+    {
+        Halide::Expr index = mutate(op->index);
+        expr = Halide::Internal::Load::make(op->type, op->name, index, op->image, op->param, op->predicate && mask);
+    }
+
+    void visit(const Halide::Internal::Store *op)
+    {
+        Halide::Expr value = mutate(op->value);
+        Halide::Expr index = mutate(op->index);
+        stmt = Halide::Internal::Store::make(op->name, value, index, op->param, op->predicate && mask);
+    }
+
+    void visit(const Halide::Internal::IfThenElse *op)
+    {
+        if (op->else_case.defined())
+        {
+            supported = false;
+            stmt = op;
+            return;
+        }
+        Halide::Expr condition = mutate(op->condition);
+        Halide::Expr outer_mask = mask;
+        mask = mask && condition;
+        stmt = mutate(op->then_case);
+        mask = outer_mask;
+    }
+
+    void visit(const Halide::Internal::Call *op)
+    {
+        if (!op->is_pure())
+        {
+            supported = false;
+        }
+        Halide::Internal::IRMutator::visit(op);
+    }
+
+    void visit(const Halide::Internal::For *op)
+    {
+        supported = false;
+        stmt = op;
+    }
+
+    void visit(const Halide::Internal::Allocate *op)
+    {
+        supported = false;
+        stmt = op;
+    }
+
+public:
+    bool supported = true;
+
+    PredicateAccesses(const Halide::Expr &mask) : mask(mask) {}
+};
+
+}
+
+Halide::Internal::Stmt generator::make_masked_vector_body(const Halide::Internal::Stmt &body,
+                                                          const Halide::Expr &mask)
+{
+    DEBUG_FCT_NAME(3);
+    DEBUG_INDENT(4);
+
+    PredicateAccesses predicate(mask);
+    Halide::Internal::Stmt result = predicate.mutate(body);
+    if (!predicate.supported)
+    {
+        DEBUG(3, tiramisu::str_dump("The body of the vectorized loop cannot be predicated, it is guarded instead."));
+        result = Halide::Internal::IfThenElse::make(mask, body);
+    }
+
+    DEBUG(10, tiramisu::str_dump("Masked vector body: "); std::cout << result);
+
+    DEBUG_INDENT(-4);
+
+    return result;
+}
+
+namespace
+{
+
+/**
+  * Replace a serial loop whose body is a wait on the element i of a
+  * request buffer (i being the loop iterator) with a call to
+  * tiramisu_MPI_Waitall on the whole range of requests.
+  */
+class BatchWaits : public Halide::Internal::IRMutator
+{
+    using Halide::Internal::IRMutator::visit;
+
+    void visit(const Halide::Internal::For *op)
+    {
+        Halide::Internal::Stmt body = mutate(op->body);
+
+        const Halide::Internal::Evaluate *eval = body.as<Halide::Internal::Evaluate>();
+        const Halide::Internal::Call *call = eval ? eval->value.as<Halide::Internal::Call>() : nullptr;
+        const Halide::Internal::Load *request = nullptr;
+        if ((call != nullptr) && (call->name == "tiramisu_MPI_Wait") && (call->args.size() == 1))
+        {
+            request = call->args[0].as<Halide::Internal::Load>();
+        }
+
+        if ((request != nullptr) && (op->for_type == Halide::Internal::ForType::Serial))
+        {
+            Halide::Expr iterator = Halide::Internal::Variable::make(op->min.type(), op->name);
+            Halide::Expr stride = Halide::Internal::simplify(
+                    Halide::Internal::substitute(op->name, iterator + 1, request->index) - request->index);
+            if (Halide::Internal::is_one(stride))
+            {
+                Halide::Expr first = Halide::Internal::simplify(
+                        Halide::Internal::substitute(op->name, op->min, request->index));
+                Halide::Expr buffer = Halide::Internal::Variable::make(Halide::type_of<struct halide_buffer_t *>(),
+                                                                       request->name + ".buffer");
+                Halide::Expr requests = Halide::Internal::Call::make(Halide::Handle(), "tiramisu_address_of_wait",
+                                                                     {buffer, first},
+                                                                     Halide::Internal::Call::Extern);
+                stmt = Halide::Internal::Evaluate::make(
+                        Halide::Internal::Call::make(Halide::Int(32), "tiramisu_MPI_Waitall",
+                                                     {op->extent, requests}, Halide::Internal::Call::Extern));
+                return;
+            }
+        }
+
+        if (body.same_as(op->body))
+        {
+            stmt = op;
+        }
+        else
+        {
+            stmt = Halide::Internal::For::make(op->name, op->min, op->extent, op->for_type, op->device_api, body);
+        }
+    }
+};
+
+}
+
+Halide::Internal::Stmt generator::make_batched_waits(const Halide::Internal::Stmt &s)
+{
+    DEBUG_FCT_NAME(3);
+    DEBUG_INDENT(4);
+
+    Halide::Internal::Stmt result = BatchWaits().mutate(s);
+
+    DEBUG(10, tiramisu::str_dump("Statement after batching the waits: "); std::cout << result);
+
+    DEBUG_INDENT(-4);
+
+    return result;
+}
+
+namespace
+{
+
+/**
+  * Find the MPI functions called by a statement, except for the calls
+  * that complete the pooled requests.
+  */
+class MPICalls : public Halide::Internal::IRVisitor
+{
+    using Halide::Internal::IRVisitor::visit;
+
+    void visit(const Halide::Internal::Call *op)
+    {
+        Halide::Internal::IRVisitor::visit(op);
+
+        if ((op->name.compare(0, 13, "tiramisu_MPI_") == 0) &&
+            (op->name != "tiramisu_MPI_Waitall") && (op->name != "tiramisu_MPI_Testsome"))
+        {
+            calls = true;
+            posts = posts || (op->name.compare(0, 14, "tiramisu_MPI_I") == 0);
+        }
+    }
+
+public:
+    bool calls = false;
+    // Whether one of the calls posts a nonblocking transfer.
+    bool posts = false;
+};
+
+/**
+  * Insert \p test at the beginning of the body of the outermost serial
+  * loops of a statement.
+  */
+class TestInLoops : public Halide::Internal::IRMutator
+{
+    using Halide::Internal::IRMutator::visit;
+
+    const Halide::Internal::Stmt &test;
+
+    void visit(const Halide::Internal::For *op)
+    {
+        if (op->for_type != Halide::Internal::ForType::Serial)
+        {
+            stmt = op;
+            return;
+        }
+        stmt = Halide::Internal::For::make(op->name, op->min, op->extent, op->for_type, op->device_api,
+                                           Halide::Internal::Block::make(test, op->body));
+    }
+
+public:
+    TestInLoops(const Halide::Internal::Stmt &test) : test(test) {}
+};
+
+/**
+  * Test the requests of a tiramisu_MPI_Waitall in the loops that run
+  * between the transfers that post these requests and the wait.  The
+  * loops must not call MPI: each of their iterations calls
+  * tiramisu_MPI_Testsome, which makes MPI progress while the loops
+  * compute and releases the completed requests to the pool early.
+  */
+class TestPendingRequests : public Halide::Internal::IRMutator
+{
+    using Halide::Internal::IRMutator::visit;
+
+    void flatten(const Halide::Internal::Stmt &s, std::vector<Halide::Internal::Stmt> &stmts)
+    {
+        const Halide::Internal::Block *block = s.as<Halide::Internal::Block>();
+        if (block != nullptr)
+        {
+            flatten(block->first, stmts);
+            flatten(block->rest, stmts);
+        }
+        else
+        {
+            stmts.push_back(s);
+        }
+    }
+
+    void visit(const Halide::Internal::Block *op)
+    {
+        std::vector<Halide::Internal::Stmt> stmts;
+        flatten(op, stmts);
+        for (auto &s : stmts)
+        {
+            s = mutate(s);
+        }
+
+        for (int i = 0; i < (int) stmts.size(); i++)
+        {
+            const Halide::Internal::Evaluate *eval = stmts[i].as<Halide::Internal::Evaluate>();
+            const Halide::Internal::Call *wait = eval ? eval->value.as<Halide::Internal::Call>() : nullptr;
+            if ((wait == nullptr) || (wait->name != "tiramisu_MPI_Waitall"))
+            {
+                continue;
+            }
+
+            // Find the loops that run since the requests were posted.
+            int first = i;
+            bool posted = false;
+            while ((first > 0) && !posted)
+            {
+                MPICalls calls;
+                stmts[first - 1].accept(&calls);
+                posted = calls.posts;
+                if (calls.calls)
+                {
+                    break;
+                }
+                first--;
+            }
+            if (!posted)
+            {
+                continue;
+            }
+
+            Halide::Internal::Stmt test = Halide::Internal::Evaluate::make(
+                    Halide::Internal::Call::make(Halide::Int(32), "tiramisu_MPI_Testsome", wait->args,
+                                                 Halide::Internal::Call::Extern));
+            for (int j = first; j < i; j++)
+            {
+                if (!stmts[j].as<Halide::Internal::Evaluate>())
+                {
+                    stmts[j] = TestInLoops(test).mutate(stmts[j]);
+                }
+            }
+        }
+
+        stmt = stmts.back();
+        for (int i = stmts.size() - 2; i >= 0; i--)
+        {
+            stmt = Halide::Internal::Block::make(stmts[i], stmt);
+        }
+    }
+};
+
+}
+
+Halide::Internal::Stmt generator::make_request_tests(const Halide::Internal::Stmt &s)
+{
+    DEBUG_FCT_NAME(3);
+    DEBUG_INDENT(4);
+
+    Halide::Internal::Stmt result = TestPendingRequests().mutate(s);
+
+    DEBUG(10, tiramisu::str_dump("Statement after testing the pending requests: "); std::cout << result);
+
+    DEBUG_INDENT(-4);
+
+    return result;
+}
+
+namespace
+{
+
+/**
+  * Find whether an expression uses one of the variables \p names, or
+  * loads from memory.
+  */
+class UsesVariablesOrLoads : public Halide::Internal::IRVisitor
+{
+    using Halide::Internal::IRVisitor::visit;
+
+    const std::set<std::string> &names;
+
+    void visit(const Halide::Internal::Variable *op)
+    {
+        if (names.count(op->name) > 0)
+        {
+            found = true;
+        }
+    }
+
+    void visit(const Halide::Internal::Load *op)
+    {
+        found = true;
+    }
+
+public:
+    bool found = false;
+
+    UsesVariablesOrLoads(const std::set<std::string> &names) : names(names) {}
+};
+
+/**
+  * A blocking transfer that can be replaced with a persistent request.
+  */
+struct PersistentTransfer
+{
+    std::string init_name;
+    Halide::Expr active;
+    std::vector<Halide::Expr> args;
+    bool is_recv;
+    // The memory region that is transferred: buffer name, first element
+    // and number of elements.
+    std::string buffer;
+    Halide::Expr first;
+    Halide::Expr count;
+};
+
+bool regions_overlap(const PersistentTransfer &a, const PersistentTransfer &b)
+{
+    if (a.buffer != b.buffer)
+    {
+        return false;
+    }
+    Halide::Expr a_first = Halide::cast(Halide::Int(64), a.first);
+    Halide::Expr b_first = Halide::cast(Halide::Int(64), b.first);
+    Halide::Expr a_end = a_first + Halide::cast(Halide::Int(64), a.count);
+    Halide::Expr b_end = b_first + Halide::cast(Halide::Int(64), b.count);
+    return !Halide::Internal::can_prove(a_end <= b_first || b_end <= a_first);
+}
+
+/**
+  * Replace the runs of consecutive blocking transfers of a loop body that
+  * do not use the variables defined in the loop with Startall/Waitall on
+  * persistent requests.  The requests are numbered from \p group.
+  */
+class HoistPersistentTransfers
+{
+    Halide::Expr group;
+    std::set<std::string> loop_variables;
+
+    // Return true if \p s is a blocking transfer whose arguments do not
+    // change during the loop, and describe it in \p transfer.
+    bool match_transfer(const Halide::Internal::Stmt &s, PersistentTransfer &transfer)
+    {
+        Halide::Expr active = Halide::Internal::const_true();
+        Halide::Internal::Stmt body = s;
+        if (const Halide::Internal::IfThenElse *op = s.as<Halide::Internal::IfThenElse>())
+        {
+            if (op->else_case.defined())
+            {
+                return false;
+            }
+            active = op->condition;
+            body = op->then_case;
+        }
+
+        const Halide::Internal::Evaluate *eval = body.as<Halide::Internal::Evaluate>();
+        const Halide::Internal::Call *call = eval ? eval->value.as<Halide::Internal::Call>() : nullptr;
+        if ((call == nullptr) || (call->call_type != Halide::Internal::Call::Extern) || (call->args.size() != 4))
+        {
+            return false;
+        }
+
+        transfer.init_name = "";
+        for (const std::string op : {"Send", "Ssend", "Recv"})
+        {
+            std::string prefix = "tiramisu_MPI_" + op + "_";
+            // The suffix is the element type: aggregated transfers are not
+            // matched.
+            if ((call->name.compare(0, prefix.size(), prefix) == 0) &&
+                (call->name.find('_', prefix.size()) == std::string::npos))
+            {
+                transfer.init_name = prefix + "init_" + call->name.substr(prefix.size());
+                transfer.is_recv = (op == "Recv");
+            }
+        }
+        if (transfer.init_name.empty())
+        {
+            return false;
+        }
+
+        // The data argument is the address of an element of a buffer.
+        const Halide::Internal::Call *address = call->args[3].as<Halide::Internal::Call>();
+        const Halide::Internal::Variable *buffer = nullptr;
+        if ((address != nullptr) && (address->name.compare(0, 20, "tiramisu_address_of_") == 0) &&
+            (address->args.size() == 2))
+        {
+            buffer = address->args[0].as<Halide::Internal::Variable>();
+        }
+        if (buffer == nullptr)
+        {
+            return false;
+        }
+
+        UsesVariablesOrLoads uses(loop_variables);
+        active.accept(&uses);
+        for (const auto &arg : call->args)
+        {
+            arg.accept(&uses);
+        }
+        if (uses.found)
+        {
+            return false;
+        }
+
+        transfer.active = active;
+        transfer.args = call->args;
+        transfer.buffer = buffer->name;
+        transfer.first = address->args[1];
+        transfer.count = call->args[0];
+        return true;
+    }
+
+    // Replace the run \p run with the start and the completion of its
+    // persistent requests.
+    Halide::Internal::Stmt make_run(const std::vector<PersistentTransfer> &run)
+    {
+        Halide::Expr first = group + (int) transfers.size();
+        for (const auto &transfer : run)
+        {
+            transfers.push_back(transfer);
+        }
+        return Halide::Internal::Block::make(
+                Halide::Internal::Evaluate::make(
+                        Halide::Internal::Call::make(Halide::Int(32), "tiramisu_MPI_Startall",
+                                                     {first, (int) run.size()}, Halide::Internal::Call::Extern)),
+                Halide::Internal::Evaluate::make(
+                        Halide::Internal::Call::make(Halide::Int(32), "tiramisu_MPI_Waitall_persistent",
+                                                     {first, (int) run.size()}, Halide::Internal::Call::Extern)));
+    }
+
+    void flatten(const Halide::Internal::Stmt &s, std::vector<Halide::Internal::Stmt> &stmts)
+    {
+        if (const Halide::Internal::Block *op = s.as<Halide::Internal::Block>())
+        {
+            flatten(op->first, stmts);
+            flatten(op->rest, stmts);
+        }
+        else
+        {
+            stmts.push_back(s);
+        }
+    }
+
+public:
+    std::vector<PersistentTransfer> transfers;
+
+    HoistPersistentTransfers(const std::string &loop, const Halide::Expr &group) : group(group)
+    {
+        loop_variables.insert(loop);
+    }
+
+    Halide::Internal::Stmt hoist(const Halide::Internal::Stmt &s)
+    {
+        if (const Halide::Internal::LetStmt *op = s.as<Halide::Internal::LetStmt>())
+        {
+            bool inserted = loop_variables.insert(op->name).second;
+            Halide::Internal::Stmt body = hoist(op->body);
+            if (inserted)
+            {
+                loop_variables.erase(op->name);
+            }
+            return body.same_as(op->body) ? s : Halide::Internal::LetStmt::make(op->name, op->value, body);
+        }
+        if (const Halide::Internal::ProducerConsumer *op = s.as<Halide::Internal::ProducerConsumer>())
+        {
+            Halide::Internal::Stmt body = hoist(op->body);
+            return body.same_as(op->body) ? s : Halide::Internal::ProducerConsumer::make(op->name, op->is_producer, body);
+        }
+
+        std::vector<Halide::Internal::Stmt> stmts;
+        flatten(s, stmts);
+
+        // A receive cannot be started together with a transfer that
+        // accesses the same elements, since it would no longer be ordered
+        // with respect to that transfer.
+        std::vector<Halide::Internal::Stmt> result;
+        std::vector<PersistentTransfer> run;
+        for (const auto &stmt : stmts)
+        {
+            PersistentTransfer transfer;
+            if (match_transfer(stmt, transfer))
+            {
+                bool conflict = false;
+                for (const auto &other : run)
+                {
+                    if ((transfer.is_recv || other.is_recv) && regions_overlap(transfer, other))
+                    {
+                        conflict = true;
+                    }
+                }
+                if (conflict)
+                {
+                    result.push_back(make_run(run));
+                    run.clear();
+                }
+                run.push_back(transfer);
+                continue;
+            }
+            if (!run.empty())
+            {
+                result.push_back(make_run(run));
+                run.clear();
+            }
+            if (stmts.size() > 1)
+            {
+                result.push_back(hoist(stmt));
+            }
+            else
+            {
+                result.push_back(stmt);
+            }
+        }
+        if (!run.empty())
+        {
+            result.push_back(make_run(run));
+        }
+
+        Halide::Internal::Stmt block = result.back();
+        for (int i = (int) result.size() - 2; i >= 0; i--)
+        {
+            block = Halide::Internal::Block::make(result[i], block);
+        }
+        return block;
+    }
+};
+
+class PersistentCommunication : public Halide::Internal::IRMutator
+{
+    using Halide::Internal::IRMutator::visit;
+
+    void visit(const Halide::Internal::For *op)
+    {
+        Halide::Internal::Stmt body = mutate(op->body);
+
+        std::string group_name = Halide::Internal::unique_name("persistent_requests");
+        Halide::Expr group = Halide::Internal::Variable::make(Halide::Int(32), group_name);
+        HoistPersistentTransfers hoist(op->name, group);
+        // Only sequential loops repeat their transfers in order.
+        if (op->for_type == Halide::Internal::ForType::Serial)
+        {
+            body = hoist.hoist(body);
+        }
+
+        if (body.same_as(op->body))
+        {
+            stmt = op;
+            return;
+        }
+
+        Halide::Internal::Stmt loop = Halide::Internal::For::make(op->name, op->min, op->extent, op->for_type,
+                                                                  op->device_api, body);
+        if (hoist.transfers.empty())
+        {
+            stmt = loop;
+            return;
+        }
+
+        int count = hoist.transfers.size();
+        std::vector<Halide::Internal::Stmt> stmts;
+        for (int i = 0; i < count; i++)
+        {
+            const PersistentTransfer &transfer = hoist.transfers[i];
+            std::vector<Halide::Expr> args = {group + i, Halide::cast(Halide::Int(32), transfer.active)};
+            args.insert(args.end(), transfer.args.begin(), transfer.args.end());
+            stmts.push_back(Halide::Internal::Evaluate::make(
+                    Halide::Internal::Call::make(Halide::Int(32), transfer.init_name, args,
+                                                 Halide::Internal::Call::Extern)));
+        }
+        stmts.push_back(loop);
+        stmts.push_back(Halide::Internal::Evaluate::make(
+                Halide::Internal::Call::make(Halide::Int(32), "tiramisu_MPI_persistent_requests_free",
+                                             {group, count}, Halide::Internal::Call::Extern)));
+
+        Halide::Internal::Stmt result = stmts.back();
+        for (int i = (int) stmts.size() - 2; i >= 0; i--)
+        {
+            result = Halide::Internal::Block::make(stmts[i], result);
+        }
+        stmt = Halide::Internal::LetStmt::make(
+                group_name,
+                Halide::Internal::Call::make(Halide::Int(32), "tiramisu_MPI_persistent_requests",
+                                             {count}, Halide::Internal::Call::Extern),
+                result);
+    }
+};
+
+}
+
+Halide::Internal::Stmt generator::make_persistent_communication(const Halide::Internal::Stmt &s)
+{
+    DEBUG_FCT_NAME(3);
+    DEBUG_INDENT(4);
+
+    Halide::Internal::Stmt result = PersistentCommunication().mutate(s);
+
+    DEBUG(10, tiramisu::str_dump("Statement after creating the persistent requests: "); std::cout << result);
+
+    DEBUG_INDENT(-4);
+
+    return result;
+}
+
+namespace
+{
+
+/**
+  * Return true if \p op is a blocking MPI transfer of a contiguous region,
+  * named \p prefix followed by the element type, and store its tag in
+  * \p tag if the tag is constant (-1 otherwise).
+  */
+bool match_blocking_transfer(const Halide::Internal::Call *op, const std::string &prefix, int64_t &tag)
+{
+    if ((op->call_type != Halide::Internal::Call::Extern) || (op->args.size() != 4) ||
+        (op->name.compare(0, prefix.size(), prefix) != 0) ||
+        (op->name.find('_', prefix.size()) != std::string::npos))
+    {
+        return false;
+    }
+    const int64_t *value = Halide::Internal::as_const_int(Halide::Internal::simplify(op->args[2]));
+    tag = (value != nullptr) ? *value : -1;
+    return true;
+}
+
+/**
+  * Find whether a statement is a communication phase: it calls blocking
+  * sends (tiramisu_MPI_Send_*) and no other MPI function.  Sends in
+  * non-sequential loops do not count as phase sends.
+  */
+class CommunicationPhase : public Halide::Internal::IRVisitor
+{
+    using Halide::Internal::IRVisitor::visit;
+
+    int parallel_loops = 0;
+
+    void visit(const Halide::Internal::For *op)
+    {
+        bool parallel = (op->for_type != Halide::Internal::ForType::Serial);
+        parallel_loops += parallel;
+        Halide::Internal::IRVisitor::visit(op);
+        parallel_loops -= parallel;
+    }
+
+    void visit(const Halide::Internal::Call *op)
+    {
+        Halide::Internal::IRVisitor::visit(op);
+
+        int64_t tag;
+        if ((parallel_loops == 0) && match_blocking_transfer(op, "tiramisu_MPI_Send_", tag))
+        {
+            sends = true;
+        }
+        else if (op->name.compare(0, 13, "tiramisu_MPI_") == 0)
+        {
+            other = true;
+        }
+    }
+
+public:
+    bool sends = false;
+    bool other = false;
+
+    static bool is_phase(const Halide::Internal::For *op)
+    {
+        if (op->for_type != Halide::Internal::ForType::Serial)
+        {
+            return false;
+        }
+        CommunicationPhase phase;
+        op->body.accept(&phase);
+        return phase.sends && !phase.other;
+    }
+};
+
+/**
+  * Find the tags of the sends that are aggregated.  The sends of a
+  * communication phase are worth aggregating if one of the loops of the
+  * phase does not change their peer, i.e. the loop sends several messages
+  * to the same peer.  A tag is only aggregated if all its sends are, so
+  * that its messages are received in the order in which they are sent.
+  */
+class FindAggregatedTags : public Halide::Internal::IRVisitor
+{
+    using Halide::Internal::IRVisitor::visit;
+
+    bool in_phase = false;
+    int parallel_loops = 0;
+    std::vector<std::string> phase_loops;
+    std::set<int64_t> candidates;
+    std::set<int64_t> excluded;
+
+    void visit(const Halide::Internal::For *op)
+    {
+        if (in_phase)
+        {
+            phase_loops.push_back(op->name);
+            Halide::Internal::IRVisitor::visit(op);
+            phase_loops.pop_back();
+        }
+        else if (op->for_type != Halide::Internal::ForType::Serial)
+        {
+            // The messages are staged by a single thread.
+            parallel_loops++;
+            Halide::Internal::IRVisitor::visit(op);
+            parallel_loops--;
+        }
+        else if ((parallel_loops == 0) && CommunicationPhase::is_phase(op))
+        {
+            in_phase = true;
+            phase_loops.push_back(op->name);
+            Halide::Internal::IRVisitor::visit(op);
+            phase_loops.pop_back();
+            in_phase = false;
+        }
+        else
+        {
+            Halide::Internal::IRVisitor::visit(op);
+        }
+    }
+
+    void visit(const Halide::Internal::Call *op)
+    {
+        Halide::Internal::IRVisitor::visit(op);
+
+        int64_t tag;
+        if (!match_blocking_transfer(op, "tiramisu_MPI_Send_", tag) || (tag < 0))
+        {
+            return;
+        }
+
+        bool repeated = false;
+        for (const auto &loop : phase_loops)
+        {
+            std::set<std::string> names = {loop};
+            UsesVariablesOrLoads uses(names);
+            op->args[1].accept(&uses);
+            op->args[2].accept(&uses);
+            repeated = repeated || !uses.found;
+        }
+        if (in_phase && repeated)
+        {
+            candidates.insert(tag);
+        }
+        else
+        {
+            excluded.insert(tag);
+        }
+    }
+
+public:
+    std::set<int64_t> get_tags() const
+    {
+        std::set<int64_t> tags;
+        for (int64_t tag : candidates)
+        {
+            if (excluded.count(tag) == 0)
+            {
+                tags.insert(tag);
+            }
+        }
+        return tags;
+    }
+};
+
+/**
+  * Replace the blocking sends and receives that use one of the tags \p tags
+  * with their aggregated version, and flush the aggregated messages at the
+  * end of each communication phase.
+  */
+class AggregateMessages : public Halide::Internal::IRMutator
+{
+    using Halide::Internal::IRMutator::visit;
+
+    const std::set<int64_t> &tags;
+    bool in_phase = false;
+
+    void visit(const Halide::Internal::For *op)
+    {
+        if (in_phase || !CommunicationPhase::is_phase(op))
+        {
+            Halide::Internal::IRMutator::visit(op);
+            return;
+        }
+
+        in_phase = true;
+        Halide::Internal::IRMutator::visit(op);
+        in_phase = false;
+        if (!stmt.same_as(op))
+        {
+            stmt = Halide::Internal::Block::make(
+                    stmt, Halide::Internal::Evaluate::make(
+                            Halide::Internal::Call::make(Halide::Int(32), "tiramisu_MPI_aggregated_flush", {},
+                                                         Halide::Internal::Call::Extern)));
+        }
+    }
+
+    void visit(const Halide::Internal::Call *op)
+    {
+        int64_t tag;
+        for (const std::string transfer : {"Send", "Recv"})
+        {
+            std::string prefix = "tiramisu_MPI_" + transfer + "_";
+            if (match_blocking_transfer(op, prefix, tag) && (tags.count(tag) > 0))
+            {
+                expr = Halide::Internal::Call::make(op->type, prefix + "aggregated_" + op->name.substr(prefix.size()),
+                                                    op->args, op->call_type);
+                return;
+            }
+        }
+        Halide::Internal::IRMutator::visit(op);
+    }
+
+public:
+    AggregateMessages(const std::set<int64_t> &tags) : tags(tags) {}
+};
+
+}
+
+Halide::Internal::Stmt generator::make_message_aggregation(const Halide::Internal::Stmt &s)
+{
+    DEBUG_FCT_NAME(3);
+    DEBUG_INDENT(4);
+
+    FindAggregatedTags find;
+    s.accept(&find);
+    std::set<int64_t> tags = find.get_tags();
+    if (tags.empty())
+    {
+        DEBUG_INDENT(-4);
+        return s;
+    }
+
+    // The aggregated messages are sent without blocking, wait for them
+    // before returning.
+    Halide::Internal::Stmt result = AggregateMessages(tags).mutate(s);
+    result = Halide::Internal::Block::make(
+            result, Halide::Internal::Evaluate::make(
+                    Halide::Internal::Call::make(Halide::Int(32), "tiramisu_MPI_aggregated_wait", {},
+                                                 Halide::Internal::Call::Extern)));
+
+    DEBUG(10, tiramisu::str_dump("Statement after aggregating the messages: "); std::cout << result);
+
+    DEBUG_INDENT(-4);
+
+    return result;
+}
+
+namespace
+{
+
+/**
+  * Collect the buffers accessed remotely by the one-sided MPI transfers of
+  * a statement: the destination of each tiramisu_MPI_Put_* call and the
+  * source of each tiramisu_MPI_Get_* call.  Each buffer is mapped to the
+  * address of its first element.
+  */
+class FindRMAWindows : public Halide::Internal::IRVisitor
+{
+    using Halide::Internal::IRVisitor::visit;
+
+    void visit(const Halide::Internal::Call *op)
+    {
+        Halide::Internal::IRVisitor::visit(op);
+
+        bool is_put = (op->name.compare(0, 17, "tiramisu_MPI_Put_") == 0);
+        bool is_get = (op->name.compare(0, 17, "tiramisu_MPI_Get_") == 0);
+        if ((!is_put && !is_get) || (op->args.size() != 4))
+        {
+            return;
+        }
+
+        // (count, peer, data, store_in), data and store_in being addresses
+        // of buffer elements.
+        const Halide::Internal::Call *address = op->args[is_put ? 3 : 2].as<Halide::Internal::Call>();
+        assert((address != nullptr) && (address->name.compare(0, 20, "tiramisu_address_of_") == 0) &&
+               (address->args.size() == 2) && "One-sided transfers must access buffer elements.");
+        const Halide::Internal::Variable *buffer = address->args[0].as<Halide::Internal::Variable>();
+        assert(buffer != nullptr);
+
+        std::string name = buffer->name.substr(0, buffer->name.rfind(".buffer"));
+        windows.insert(std::make_pair(name, Halide::Internal::Call::make(address->type, address->name,
+                                                                         {address->args[0], Halide::Expr(0)},
+                                                                         Halide::Internal::Call::Extern)));
+    }
+
+public:
+    std::map<std::string, Halide::Expr> windows;
+};
+
+/**
+  * Enclose the one-sided MPI transfers of a statement in fence epochs on
+  * the windows they access.  A fence is collective, so the statements are
+  * only descended into as long as every rank executes them: blocks, and
+  * loops and lets that do not depend on the rank.  Any other statement
+  * containing one-sided transfers (typically the condition on the rank of
+  * a distributed loop) is enclosed as a whole, and consecutive epochs
+  * share their fences.
+  */
+class RMAEpochs : public Halide::Internal::IRMutator
+{
+    using Halide::Internal::IRMutator::visit;
+
+    const std::string &prefix;
+
+    std::set<std::string> windows_of(const Halide::Internal::Stmt &s)
+    {
+        FindRMAWindows find;
+        s.accept(&find);
+        std::set<std::string> result;
+        for (const auto &w : find.windows)
+        {
+            result.insert(w.first);
+        }
+        return result;
+    }
+
+    Halide::Internal::Stmt make_fences(const std::set<std::string> &windows)
+    {
+        Halide::Internal::Stmt result;
+        for (const auto &w : windows)
+        {
+            Halide::Internal::Stmt fence = Halide::Internal::Evaluate::make(
+                    Halide::Internal::Call::make(Halide::Int(32), "tiramisu_MPI_Win_fence",
+                                                 {Halide::Internal::StringImm::make(prefix + w)},
+                                                 Halide::Internal::Call::Extern));
+            result = result.defined() ? Halide::Internal::Block::make(result, fence) : fence;
+        }
+        return result;
+    }
+
+    bool is_uniform(const Halide::Expr &e)
+    {
+        std::set<std::string> rank = {"rank"};
+        UsesVariablesOrLoads uses(rank);
+        e.accept(&uses);
+        return !uses.found;
+    }
+
+    void flatten(const Halide::Internal::Stmt &s, std::vector<Halide::Internal::Stmt> &stmts)
+    {
+        const Halide::Internal::Block *block = s.as<Halide::Internal::Block>();
+        if (block != nullptr)
+        {
+            flatten(block->first, stmts);
+            flatten(block->rest, stmts);
+        }
+        else
+        {
+            stmts.push_back(s);
+        }
+    }
+
+    void visit(const Halide::Internal::Block *op)
+    {
+        std::vector<Halide::Internal::Stmt> stmts;
+        flatten(op, stmts);
+
+        // The windows fenced by the last statement, if it is a fence.
+        std::set<std::string> fenced;
+        std::vector<Halide::Internal::Stmt> result;
+        for (const auto &s : stmts)
+        {
+            std::set<std::string> windows = windows_of(s);
+            if (windows.empty())
+            {
+                result.push_back(s);
+                fenced.clear();
+            }
+            else if (s.as<Halide::Internal::For>() || s.as<Halide::Internal::LetStmt>())
+            {
+                result.push_back(mutate(s));
+                fenced.clear();
+            }
+            else
+            {
+                if (windows != fenced)
+                {
+                    result.push_back(make_fences(windows));
+                }
+                result.push_back(s);
+                result.push_back(make_fences(windows));
+                fenced = windows;
+            }
+        }
+
+        stmt = result.back();
+        for (int i = result.size() - 2; i >= 0; i--)
+        {
+            stmt = Halide::Internal::Block::make(result[i], stmt);
+        }
+    }
+
+    void visit(const Halide::Internal::For *op)
+    {
+        if (is_uniform(op->min) && is_uniform(op->extent))
+        {
+            Halide::Internal::IRMutator::visit(op);
+        }
+        else
+        {
+            enclose(op);
+        }
+    }
+
+    void visit(const Halide::Internal::LetStmt *op)
+    {
+        if (is_uniform(op->value))
+        {
+            Halide::Internal::IRMutator::visit(op);
+        }
+        else
+        {
+            enclose(op);
+        }
+    }
+
+    void enclose(const Halide::Internal::Stmt &s)
+    {
+        std::set<std::string> windows = windows_of(s);
+        if (windows.empty())
+        {
+            stmt = s;
+        }
+        else
+        {
+            stmt = Halide::Internal::Block::make(make_fences(windows),
+                                                 Halide::Internal::Block::make(s, make_fences(windows)));
+        }
+    }
+
+public:
+    RMAEpochs(const std::string &prefix) : prefix(prefix) {}
+
+    Halide::Internal::Stmt make(const Halide::Internal::Stmt &s)
+    {
+        // A statement that is neither a block, a loop nor a let is
+        // enclosed as a whole.
+        if (s.as<Halide::Internal::Block>() || s.as<Halide::Internal::For>() || s.as<Halide::Internal::LetStmt>())
+        {
+            return mutate(s);
+        }
+        enclose(s);
+        return stmt;
+    }
+};
+
+}
+
+Halide::Internal::Stmt generator::make_rma_epochs(const tiramisu::function &fct, const Halide::Internal::Stmt &s)
+{
+    DEBUG_FCT_NAME(3);
+    DEBUG_INDENT(4);
+
+    FindRMAWindows find;
+    s.accept(&find);
+    if (find.windows.empty())
+    {
+        DEBUG_INDENT(-4);
+        return s;
+    }
+
+    // Window names are prefixed with the name of the function so that the
+    // buffers of different functions are exposed separately.
+    std::string prefix = fct.get_name() + ".";
+    Halide::Internal::Stmt result = RMAEpochs(prefix).make(s);
+
+    // Expose the buffers at the beginning of the function.  Exposing a
+    // buffer is collective, every rank exposes the same buffers in the same
+    // order.
+    for (auto w = find.windows.rbegin(); w != find.windows.rend(); w++)
+    {
+        const auto &buffer_entry = fct.get_buffers().find(w->first);
+        assert(buffer_entry != fct.get_buffers().end());
+        const tiramisu::buffer *buf = buffer_entry->second;
+
+        Halide::Expr size = Halide::Expr((uint64_t) halide_type_from_tiramisu_type(buf->get_elements_type()).bytes());
+        for (const auto &sz : buf->get_dim_sizes())
+        {
+            std::vector<isl_ast_expr *> ie = {};
+            size = size * Halide::cast(Halide::UInt(64), generator::halide_expr_from_tiramisu_expr(&fct, ie, sz));
+        }
+
+        Halide::Internal::Stmt expose = Halide::Internal::Evaluate::make(
+                Halide::Internal::Call::make(Halide::Int(32), "tiramisu_MPI_Win_expose",
+                                             {Halide::Internal::StringImm::make(prefix + w->first), w->second, size},
+                                             Halide::Internal::Call::Extern));
+        result = Halide::Internal::Block::make(expose, result);
+    }
+
+    DEBUG(10, tiramisu::str_dump("Statement after creating the RMA epochs: "); std::cout << result);
+
+    DEBUG_INDENT(-4);
+
+    return result;
+}
+
 }
@@ -0,0 +1,238 @@
+#include <llvm/Analysis/InstructionSimplify.h>
+#include <llvm/IR/BasicBlock.h>
+#include <llvm/IR/Constants.h>
+#include <llvm/IR/Function.h>
+#include <llvm/IR/IRBuilder.h>
+#include <llvm/IR/Instructions.h>
+#include <llvm/IR/Intrinsics.h>
+#include <llvm/IR/LLVMContext.h>
+#include <llvm/IR/Metadata.h>
+#include <llvm/IR/Module.h>
+#include <llvm/Support/raw_ostream.h>
+
+#include <algorithm>
+#include <cassert>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <tiramisu/debug.h>
+#include <tiramisu/core.h>
+
+namespace tiramisu
+{
+
+namespace
+{
+
+/**
+  * Return the values of the function \p f whose computation depends on a
+  * call to the non-temporal store marker \p marker, i.e., the addresses of
+  * the stores of the computations tagged with tag_nontemporal_store().
+  *
+  * A value depends on the marker if it is a call to the marker or if one
+  * of its operands depends on the marker.  A phi node or a select only
+  * depends on the marker if all the values that it merges do, so that a
+  * store that was sunk from a tagged and an untagged computation is not
+  * marked.  Loaded values never depend on the marker.
+  */
+std::set<llvm::Value *> get_marked_values(llvm::Function &f, llvm::Function *marker)
+{
+    // Every value reachable from a call to the marker.
+    std::set<llvm::Value *> marked;
+    std::vector<llvm::Value *> worklist;
+    for (llvm::User *user : marker->users())
+    {
+        llvm::CallInst *call = llvm::dyn_cast<llvm::CallInst>(user);
+        if ((call != nullptr) && (call->getFunction() == &f))
+        {
+            marked.insert(call);
+            worklist.push_back(call);
+        }
+    }
+    while (!worklist.empty())
+    {
+        llvm::Value *v = worklist.back();
+        worklist.pop_back();
+        for (llvm::User *user : v->users())
+        {
+            if (llvm::isa<llvm::Instruction>(user) && !llvm::isa<llvm::LoadInst>(user) &&
+                !llvm::isa<llvm::StoreInst>(user) && marked.insert(user).second)
+            {
+                worklist.push_back(user);
+            }
+        }
+    }
+
+    // Remove the phi nodes and selects that also merge unmarked values,
+    // and the values computed from them only, until nothing changes.
+    bool changed = true;
+    while (changed)
+    {
+        changed = false;
+        for (auto it = marked.begin(); it != marked.end();)
+        {
+            llvm::Instruction *inst = llvm::cast<llvm::Instruction>(*it);
+            bool keep;
+            if (llvm::CallInst *call = llvm::dyn_cast<llvm::CallInst>(inst))
+            {
+                keep = (call->getCalledFunction() == marker) ||
+                       std::any_of(call->arg_begin(), call->arg_end(),
+                                   [&](llvm::Value *op) { return marked.count(op) > 0; });
+            }
+            else if (llvm::PHINode *phi = llvm::dyn_cast<llvm::PHINode>(inst))
+            {
+                keep = std::all_of(phi->incoming_values().begin(), phi->incoming_values().end(),
+                                   [&](llvm::Value *op) { return marked.count(op) > 0; });
+            }
+            else if (llvm::SelectInst *select = llvm::dyn_cast<llvm::SelectInst>(inst))
+            {
+                keep = (marked.count(select->getTrueValue()) > 0) && (marked.count(select->getFalseValue()) > 0);
+            }
+            else
+            {
+                keep = std::any_of(inst->op_begin(), inst->op_end(),
+                                   [&](llvm::Value *op) { return marked.count(op) > 0; });
+            }
+
+            if (keep)
+            {
+                ++it;
+            }
+            else
+            {
+                it = marked.erase(it);
+                changed = true;
+            }
+        }
+    }
+
+    return marked;
+}
+
+/**
+  * Mark the stores of the computations tagged with tag_nontemporal_store()
+  * as non-temporal and insert a fence before each return of the functions
+  * that contain such stores.
+  *
+  * The index of each tagged store is offset by a multiple of the result of
+  * the marker (see nontemporal_store_marker()).  The marker is a pure
+  * function, so it does not prevent the optimization of the loops: LLVM
+  * hoists it out of them.  The stores whose address depends on the marker
+  * are the stores of the tagged computations, whatever the other stores
+  * into the same buffers.  The marker is then replaced with 0 and the
+  * offsets are simplified away.
+  *
+  * Non-temporal stores are weakly ordered, so the fence makes them
+  * visible to the caller (or to the thread that waits for the end of a
+  * parallel task, since each task is a separate function).
+  */
+void mark_nontemporal_stores(llvm::Module &module, bool x86)
+{
+    DEBUG_FCT_NAME(3);
+    DEBUG_INDENT(4);
+
+    llvm::Function *marker = module.getFunction(nontemporal_store_marker());
+    if (marker == nullptr)
+    {
+        DEBUG_INDENT(-4);
+        return;
+    }
+
+    llvm::LLVMContext &context = module.getContext();
+    llvm::MDNode *nontemporal = llvm::MDNode::get(context, llvm::ConstantAsMetadata::get(
+                                    llvm::ConstantInt::get(llvm::Type::getInt32Ty(context), 1)));
+
+    for (llvm::Function &f : module)
+    {
+        if (f.isDeclaration())
+        {
+            continue;
+        }
+
+        std::set<llvm::Value *> marked = get_marked_values(f, marker);
+        if (marked.empty())
+        {
+            continue;
+        }
+
+        int nb_stores = 0;
+        for (llvm::BasicBlock &bb : f)
+        {
+            for (llvm::Instruction &inst : bb)
+            {
+                llvm::StoreInst *store = llvm::dyn_cast<llvm::StoreInst>(&inst);
+                if ((store != nullptr) && (marked.count(store->getPointerOperand()) > 0))
+                {
+                    store->setMetadata(llvm::LLVMContext::MD_nontemporal, nontemporal);
+                    nb_stores++;
+                }
+            }
+        }
+
+        if (nb_stores == 0)
+        {
+            continue;
+        }
+
+        DEBUG(3, tiramisu::str_dump("Function " + f.getName().str() + ": " +
+                                    std::to_string(nb_stores) + " non-temporal stores."));
+
+        for (llvm::BasicBlock &bb : f)
+        {
+            llvm::ReturnInst *ret = llvm::dyn_cast_or_null<llvm::ReturnInst>(bb.getTerminator());
+            if (ret != nullptr)
+            {
+                llvm::IRBuilder<> builder(ret);
+                if (x86)
+                {
+                    builder.CreateCall(llvm::Intrinsic::getDeclaration(&module, llvm::Intrinsic::x86_sse_sfence));
+                }
+                else
+                {
+                    builder.CreateFence(llvm::AtomicOrdering::SequentiallyConsistent);
+                }
+            }
+        }
+    }
+
+    // Remove the offsets: the marker returns 0.
+    std::vector<llvm::CallInst *> calls;
+    for (llvm::User *user : marker->users())
+    {
+        calls.push_back(llvm::cast<llvm::CallInst>(user));
+    }
+    for (llvm::CallInst *call : calls)
+    {
+        llvm::replaceAndRecursivelySimplify(call, llvm::ConstantInt::get(call->getType(), 0));
+    }
+    assert(marker->use_empty());
+    marker->eraseFromParent();
+
+    DEBUG_INDENT(-4);
+}
+
+}
+
+std::string nontemporal_store_marker()
+{
+    return "tiramisu_nontemporal_store";
+}
+
+void compile_halide_module_with_nontemporal_stores(const Halide::Module &m, const std::string &obj_file_name)
+{
+    DEBUG_FCT_NAME(3);
+    DEBUG_INDENT(4);
+
+    llvm::LLVMContext context;
+    std::unique_ptr<llvm::Module> module = Halide::compile_module_to_llvm_module(m, context);
+
+    mark_nontemporal_stores(*module, m.target().arch == Halide::Target::X86);
+
+    std::unique_ptr<llvm::raw_fd_ostream> out = Halide::make_raw_fd_ostream(obj_file_name);
+    Halide::compile_llvm_module_to_object(*module, *out);
+
+    DEBUG_INDENT(-4);
+}
+
+}
@@ -2,6 +2,7 @@
 #include <isl/aff.h>
 #include <isl/set.h>
 #include <isl/map.h>
+#include <isl/ilp.h>
 #include <isl/id.h>
 #include <isl/constraint.h>
 #include <isl/union_map.h>
@@ -11,6 +12,8 @@
 #include <tiramisu/debug.h>
 #include <tiramisu/core.h>
 
+#include <limits>
+
 #ifdef _WIN32
 #include <iso646.h>
 #endif
@@ -407,6 +410,68 @@ void tiramisu::computation::parallelize(tiramisu::var par_dim_var)
     DEBUG_INDENT(-4);
 }
 
+void tiramisu::computation::parallelize(tiramisu::var par_dim_var, tiramisu::parallel_schedule_t policy,
+                                        int chunk_size)
+{
+    DEBUG_FCT_NAME(3);
+    DEBUG_INDENT(4);
+
+    if (chunk_size < 0)
+    {
+        ERROR("The chunk size passed to parallelize() should be positive.", true);
+    }
+
+    this->parallelize(par_dim_var);
+
+    if (policy != tiramisu::s_default)
+    {
+        std::vector<int> dimensions =
+            this->get_loop_level_numbers_from_dimension_names({par_dim_var.get_name()});
+        this->get_function()->add_parallel_schedule(this->get_name(), dimensions[0], policy, chunk_size);
+    }
+
+    DEBUG_INDENT(-4);
+}
+
+void tiramisu::computation::prefetch(tiramisu::buffer &buff, tiramisu::var L0_var, int distance)
+{
+    DEBUG_FCT_NAME(3);
+    DEBUG_INDENT(4);
+
+    assert(L0_var.get_name().length() > 0);
+    assert(!this->get_name().empty());
+    assert(this->get_function() != NULL);
+
+    if (distance < 0)
+    {
+        ERROR("The prefetch distance should be positive (or 0 for an automatic distance).", true);
+    }
+
+    std::vector<int> dimensions =
+        this->get_loop_level_numbers_from_dimension_names({L0_var.get_name()});
+    this->check_dimensions_validity(dimensions);
+    int L0 = dimensions[0];
+
+    DEBUG(3, tiramisu::str_dump("Prefetching " + buff.get_name() + " at the loop level " +
+                                std::to_string(L0) + " of " + this->get_name() +
+                                " with a distance of " + std::to_string(distance)));
+
+    this->get_function()->add_prefetch_dimension(this->get_name(), L0, buff.get_name(), distance);
+
+    DEBUG_INDENT(-4);
+}
+
+void tiramisu::computation::prefetch(tiramisu::computation &inp, tiramisu::var L0_var, int distance)
+{
+    tiramisu::buffer *buff = inp.get_buffer();
+
+    if (buff == nullptr)
+    {
+        ERROR("Computation " + inp.get_name() + " is not stored in a buffer, it cannot be prefetched.", true);
+    }
+
+    this->prefetch(*buff, L0_var, distance);
+}
 
 void tiramisu::computation::tag_parallel_level(int par_dim)
 {
@@ -583,6 +648,111 @@ void tiramisu::computation::tag_distribute_level(int L)
     DEBUG_INDENT(-4);
 }
 
+void tiramisu::computation::tag_distribute_level(tiramisu::var L, tiramisu::distribution_t policy, int nb_ranks,
+                                                 int block_size)
+{
+    DEBUG_FCT_NAME(3);
+    DEBUG_INDENT(4);
+
+    if (nb_ranks <= 0)
+    {
+        ERROR("The number of ranks passed to tag_distribute_level() should be positive.", true);
+    }
+    if ((policy == tiramisu::d_block_cyclic) && (block_size <= 0))
+    {
+        ERROR("A block-cyclic distribution needs a positive block size.", true);
+    }
+    if (policy == tiramisu::d_weighted)
+    {
+        ERROR("A weighted distribution needs the weights of the ranks.", true);
+    }
+
+    this->tag_distribute_level(L);
+
+    if (policy != tiramisu::d_rank)
+    {
+        std::vector<int> dimensions =
+            this->get_loop_level_numbers_from_dimension_names({L.get_name()});
+        this->get_function()->add_distribution_policy(this->get_name(), dimensions[0], policy,
+                                                      (policy == tiramisu::d_cyclic) ? 1 : block_size,
+                                                      std::vector<int>(nb_ranks, 1));
+    }
+
+    DEBUG_INDENT(-4);
+}
+
+void tiramisu::computation::tag_distribute_level(tiramisu::var L, const std::vector<int> &weights)
+{
+    DEBUG_FCT_NAME(3);
+    DEBUG_INDENT(4);
+
+    if (weights.empty())
+    {
+        ERROR("A weighted distribution needs at least one rank.", true);
+    }
+    long total = 0;
+    for (int w : weights)
+    {
+        if (w < 0)
+        {
+            ERROR("The weights of the ranks should not be negative.", true);
+        }
+        total += w;
+    }
+    if (total == 0)
+    {
+        ERROR("At least one of the weights of the ranks should be positive.", true);
+    }
+
+    this->tag_distribute_level(L);
+
+    std::vector<int> dimensions =
+        this->get_loop_level_numbers_from_dimension_names({L.get_name()});
+    this->get_function()->add_distribution_policy(this->get_name(), dimensions[0], tiramisu::d_weighted, 0,
+                                                  weights);
+
+    DEBUG_INDENT(-4);
+}
+
+void tiramisu::computation::tag_nontemporal_store()
+{
+    DEBUG_FCT_NAME(3);
+    DEBUG_INDENT(4);
+
+    assert(!this->get_name().empty());
+    assert(this->get_function() != NULL);
+
+    this->get_function()->add_nontemporal_store(this->get_name());
+
+    DEBUG_INDENT(-4);
+}
+
+void tiramisu::computation::tag_atomic_update()
+{
+    DEBUG_FCT_NAME(3);
+    DEBUG_INDENT(4);
+
+    assert(!this->get_name().empty());
+    assert(this->get_function() != NULL);
+
+    this->get_function()->add_atomic_update(this->get_name());
+
+    DEBUG_INDENT(-4);
+}
+
+void tiramisu::computation::tag_task_parallel()
+{
+    DEBUG_FCT_NAME(3);
+    DEBUG_INDENT(4);
+
+    assert(!this->get_name().empty());
+    assert(this->get_function() != NULL);
+
+    this->get_function()->add_task_parallel_computation(this->get_name());
+
+    DEBUG_INDENT(-4);
+}
+
 void tiramisu::computation::tag_parallel_level(tiramisu::var L0_var)
 {
     DEBUG_FCT_NAME(3);
@@ -599,6 +769,32 @@ void tiramisu::computation::tag_parallel_level(tiramisu::var L0_var)
     DEBUG_INDENT(-4);
 }
 
+void tiramisu::computation::collapse(tiramisu::var L0_var, tiramisu::var L1_var)
+{
+    DEBUG_FCT_NAME(3);
+    DEBUG_INDENT(4);
+
+    assert(L0_var.get_name().length() > 0);
+    assert(L1_var.get_name().length() > 0);
+    assert(this->get_function() != NULL);
+
+    std::vector<int> dimensions =
+        this->get_loop_level_numbers_from_dimension_names({L0_var.get_name(), L1_var.get_name()});
+    this->check_dimensions_validity(dimensions);
+    int L0 = dimensions[0];
+    int L1 = dimensions[1];
+
+    if (L0 >= L1)
+    {
+        ERROR("The first argument to collapse() should be an outer loop level of the second argument.", true);
+    }
+
+    this->tag_parallel_level(L0);
+    this->get_function()->add_collapsed_loops(this->get_name(), L0, L1 - L0 + 1);
+
+    DEBUG_INDENT(-4);
+}
+
 void tiramisu::computation::tag_unroll_level(tiramisu::var L0_var)
 {
 	this->tag_unroll_level(L0_var, 0);
@@ -1219,6 +1415,46 @@ void tiramisu::computation::vectorize(tiramisu::var L0_var, int v, tiramisu::var
     DEBUG_INDENT(-4);
 }
 
+void tiramisu::computation::vectorize(tiramisu::var L0_var, int v, tiramisu::vector_tail_t tail)
+{
+    DEBUG_FCT_NAME(3);
+    DEBUG_INDENT(4);
+
+    tiramisu::var L0_outer = tiramisu::var(generate_new_variable_name());
+    tiramisu::var L0_inner = tiramisu::var(generate_new_variable_name());
+    this->vectorize(L0_var, v, tail, L0_outer, L0_inner);
+
+    DEBUG_INDENT(-4);
+}
+
+void tiramisu::computation::vectorize(tiramisu::var L0_var, int v, tiramisu::vector_tail_t tail,
+                                      tiramisu::var L0_outer, tiramisu::var L0_inner)
+{
+    DEBUG_FCT_NAME(3);
+    DEBUG_INDENT(4);
+
+    if (tail == tiramisu::v_epilogue)
+    {
+        this->vectorize(L0_var, v, L0_outer, L0_inner);
+        DEBUG_INDENT(-4);
+        return;
+    }
+
+    assert(L0_var.get_name().length() > 0);
+    std::vector<int> dimensions =
+        this->get_loop_level_numbers_from_dimension_names({L0_var.get_name()});
+    this->check_dimensions_validity(dimensions);
+    int L0 = dimensions[0];
+
+    // The loop is split without being separated: the last iteration of
+    // L0_outer executes the partial vector.
+    this->split(L0_var, v, L0_outer, L0_inner);
+    this->tag_vector_level(L0 + 1, v);
+    this->get_function()->add_vector_tail(this->get_name(), L0 + 1, tail);
+
+    DEBUG_INDENT(-4);
+}
+
 tiramisu::computation& computation::get_last_update()
 {
     return this->get_update(this->get_updates().size()-1);
@@ -1292,6 +1528,48 @@ void tiramisu::computation::unroll(tiramisu::var L0_var, int v, tiramisu::var L0
     DEBUG_INDENT(-4);
 }
 
+void tiramisu::computation::unroll_and_jam(tiramisu::var L0_var, int factor)
+{
+    DEBUG_FCT_NAME(3);
+    DEBUG_INDENT(4);
+
+    assert(L0_var.get_name().length() > 0);
+    assert(this->get_function() != NULL);
+
+    std::vector<int> dimensions =
+        this->get_loop_level_numbers_from_dimension_names({L0_var.get_name()});
+    this->check_dimensions_validity(dimensions);
+
+    if (factor < 2)
+    {
+        ERROR("The factor passed to unroll_and_jam() should be greater than 1.", true);
+    }
+
+    // The loop is unrolled and jammed when the Halide loops are generated:
+    // this keeps the remainder iterations in the same loop nest and does
+    // not require a constant extent.
+    this->get_function()->add_unroll_and_jam_dimension(this->get_name(), dimensions[0], factor);
+
+    DEBUG_INDENT(-4);
+}
+
+void tiramisu::computation::promote_to_register(tiramisu::var L0_var)
+{
+    DEBUG_FCT_NAME(3);
+    DEBUG_INDENT(4);
+
+    assert(L0_var.get_name().length() > 0);
+    assert(this->get_function() != NULL);
+
+    std::vector<int> dimensions =
+        this->get_loop_level_numbers_from_dimension_names({L0_var.get_name()});
+    this->check_dimensions_validity(dimensions);
+
+    this->get_function()->add_register_promotion(this->get_name(), dimensions[0]);
+
+    DEBUG_INDENT(-4);
+}
+
 void computation::dump_iteration_domain() const
 {
     if (ENABLE_DEBUG)
@@ -1485,6 +1763,36 @@ bool buffer::get_auto_allocate()
     return this->auto_allocate;
 }
 
+void buffer::set_numa_first_touch(bool numa_first_touch)
+{
+    this->numa_first_touch = numa_first_touch;
+}
+
+bool buffer::get_numa_first_touch()
+{
+    return this->numa_first_touch;
+}
+
+void buffer::set_huge_pages(bool huge_pages)
+{
+    this->huge_pages = huge_pages;
+}
+
+bool buffer::get_huge_pages()
+{
+    return this->huge_pages;
+}
+
+void buffer::set_node_shared(bool node_shared)
+{
+    this->node_shared = node_shared;
+}
+
+bool buffer::get_node_shared()
+{
+    return this->node_shared;
+}
+
 void computation::set_schedule(std::string map_str)
 {
     assert(!map_str.empty());
@@ -5371,35 +5679,230 @@ void computation::split(int L0, int sizeX)
     DEBUG_INDENT(-4);
 }
 
-// Function for the buffer class
+void computation::time_tile(tiramisu::var t, tiramisu::var i, int size,
+                            tiramisu::var T, tiramisu::var P, tiramisu::var t1, tiramisu::var i1, int slope)
+{
+    DEBUG_FCT_NAME(3);
+    DEBUG_INDENT(4);
 
-std::string str_tiramisu_type_op(tiramisu::op_t type)
+    assert(t.get_name().length() > 0);
+    assert(i.get_name().length() > 0);
+
+    std::vector<std::string> original_loop_level_names = this->get_loop_level_names();
+
+    std::vector<int> dimensions =
+        this->get_loop_level_numbers_from_dimension_names({t.get_name(), i.get_name()});
+    this->check_dimensions_validity(dimensions);
+    this->assert_names_not_assigned({T.get_name(), P.get_name()});
+
+    this->time_tile(dimensions[0], dimensions[1], size, slope);
+
+    this->update_names(original_loop_level_names,
+                       {T.get_name(), P.get_name(), t1.get_name(), i1.get_name()}, dimensions[0], 2);
+
+    DEBUG_INDENT(-4);
+}
+
+void computation::time_tile(tiramisu::var t, tiramisu::var i, tiramisu::var j, int size, int sizeY,
+                            tiramisu::var T, tiramisu::var P, tiramisu::var J,
+                            tiramisu::var t1, tiramisu::var i1, tiramisu::var j1, int slope)
 {
-    switch (type)
-    {
-    case tiramisu::o_logical_and:
-        return "and";
-    case tiramisu::o_logical_or:
-        return "or";
-    case tiramisu::o_max:
-        return "max";
-    case tiramisu::o_min:
-        return "min";
-    case tiramisu::o_minus:
-        return "minus";
-    case tiramisu::o_add:
-        return "add";
-    case tiramisu::o_sub:
-        return "sub";
-    case tiramisu::o_mul:
-        return "mul";
-    case tiramisu::o_div:
-        return "div";
-    case tiramisu::o_mod:
-        return "mod";
-    case tiramisu::o_select:
-        return "select";
-    case tiramisu::o_lerp:
+    DEBUG_FCT_NAME(3);
+    DEBUG_INDENT(4);
+
+    assert(t.get_name().length() > 0);
+    assert(i.get_name().length() > 0);
+    assert(j.get_name().length() > 0);
+
+    std::vector<std::string> original_loop_level_names = this->get_loop_level_names();
+
+    std::vector<int> dimensions =
+        this->get_loop_level_numbers_from_dimension_names({t.get_name(), i.get_name(), j.get_name()});
+    this->check_dimensions_validity(dimensions);
+    this->assert_names_not_assigned({T.get_name(), P.get_name(), J.get_name()});
+
+    this->time_tile(dimensions[0], dimensions[1], dimensions[2], size, sizeY, slope);
+
+    this->update_names(original_loop_level_names,
+                       {T.get_name(), P.get_name(), J.get_name(), t1.get_name(), i1.get_name(), j1.get_name()},
+                       dimensions[0], 3);
+
+    DEBUG_INDENT(-4);
+}
+
+void computation::time_tile(int t, int i, int size, int slope)
+{
+    this->time_tile(std::vector<int>({t, i}), std::vector<int>({size}), slope);
+}
+
+void computation::time_tile(int t, int i, int j, int size, int sizeY, int slope)
+{
+    this->time_tile(std::vector<int>({t, i, j}), std::vector<int>({size, sizeY}), slope);
+}
+
+/**
+ * Modify the schedule of this computation so that the loop levels
+ * levels[0] (time) and levels[1] (space) are tiled with diamonds and the
+ * loop levels levels[2], ... (space) are tiled with parallelograms.
+ *
+ * The loop levels (t, i, j) become (T, P, J, t, i, j) where
+ *   P = floor((slope*t + i)/size),
+ *   T = P + floor((slope*t - i)/size),
+ *   J = floor((slope*t + j)/sizeY).
+ */
+void computation::time_tile(std::vector<int> levels, std::vector<int> sizes, int slope)
+{
+    DEBUG_FCT_NAME(3);
+    DEBUG_INDENT(4);
+
+    assert(levels.size() >= 2);
+    assert(sizes.size() == levels.size() - 1);
+    assert(slope >= 1);
+
+    for (int k = 1; k < levels.size(); k++)
+    {
+        if (levels[k - 1] + 1 != levels[k])
+        {
+            ERROR("Loop levels passed to time_tile() should be consecutive. The first argument to time_tile() should be the time loop level.", true);
+        }
+    }
+    for (auto size : sizes)
+    {
+        assert(size >= 1);
+    }
+
+    this->get_function()->align_schedules();
+    assert(this->get_schedule() != NULL);
+
+    int dim_t = loop_level_into_dynamic_dimension(levels[0]);
+
+    isl_map *schedule = this->get_schedule();
+    int duplicate_ID = isl_map_get_static_dim(schedule, 0);
+
+    schedule = isl_map_copy(schedule);
+    schedule = isl_map_set_tuple_id(schedule, isl_dim_out,
+                                    isl_id_alloc(this->get_ctx(), this->get_name().c_str(), NULL));
+
+    DEBUG(3, tiramisu::str_dump("Original schedule: ", isl_map_to_str(schedule)));
+    DEBUG(3, tiramisu::str_dump("Time tiling dimension " + std::to_string(dim_t) +
+                                " with " + std::to_string(levels.size() - 1) + " spatial dimensions"));
+
+    int n_dims = isl_map_dim(this->get_schedule(), isl_dim_out);
+    std::vector<std::string> dimensions_str;
+    for (int k = 0; k < n_dims; k++)
+    {
+        dimensions_str.push_back(generate_new_variable_name());
+    }
+    std::string t_str = dimensions_str[dim_t];
+    std::string slope_t = std::to_string(slope) + "*" + t_str;
+
+    // The new loop levels (and the static dimensions that follow them).
+    std::vector<std::string> tile_dims_str;
+    std::vector<std::string> constraints;
+    for (int k = 0; k < levels.size(); k++)
+    {
+        tile_dims_str.push_back(generate_new_variable_name());
+        tile_dims_str.push_back(generate_new_variable_name());
+        constraints.push_back(tile_dims_str.back() + " = 0");
+    }
+    std::string i_str = dimensions_str[loop_level_into_dynamic_dimension(levels[1])];
+    std::string size_str = std::to_string(sizes[0]);
+    constraints.push_back(tile_dims_str[2] + " = floor((" + slope_t + " + " + i_str + ")/" + size_str + ")");
+    constraints.push_back(tile_dims_str[0] + " = " + tile_dims_str[2] + " + floor((" +
+                          slope_t + " - " + i_str + ")/" + size_str + ")");
+    for (int k = 2; k < levels.size(); k++)
+    {
+        std::string j_str = dimensions_str[loop_level_into_dynamic_dimension(levels[k])];
+        constraints.push_back(tile_dims_str[2 * k] + " = floor((" + slope_t + " + " + j_str + ")/" +
+                              std::to_string(sizes[k - 1]) + ")");
+    }
+
+    std::vector<std::string> out_dims_str;
+    for (int k = 0; k < n_dims; k++)
+    {
+        if (k == dim_t)
+        {
+            out_dims_str.insert(out_dims_str.end(), tile_dims_str.begin(), tile_dims_str.end());
+        }
+        out_dims_str.push_back(dimensions_str[k]);
+    }
+
+    std::string map = "{" + this->get_name() + "[";
+    for (int k = 0; k < n_dims; k++)
+    {
+        map = map + dimensions_str[k] + ((k != n_dims - 1) ? "," : "");
+    }
+    map = map + "] -> " + this->get_name() + "[";
+    for (int k = 0; k < out_dims_str.size(); k++)
+    {
+        map = map + out_dims_str[k] + ((k != out_dims_str.size() - 1) ? "," : "");
+    }
+    map = map + "] : " + dimensions_str[0] + " = " + std::to_string(duplicate_ID);
+    for (const auto &c : constraints)
+    {
+        map = map + " and " + c;
+    }
+    map = map + "}";
+
+    DEBUG(3, tiramisu::str_dump("Transformation map (string format) : " + map));
+
+    isl_map *transformation_map = isl_map_read_from_str(this->get_ctx(), map.c_str());
+
+    for (int k = 0; k < out_dims_str.size(); k++)
+        transformation_map = isl_map_set_dim_id(
+                                 transformation_map, isl_dim_out, k,
+                                 isl_id_alloc(this->get_ctx(), out_dims_str[k].c_str(), NULL));
+
+    transformation_map = isl_map_set_tuple_id(
+                             transformation_map, isl_dim_in,
+                             isl_map_get_tuple_id(isl_map_copy(schedule), isl_dim_out));
+    isl_id *id_range = isl_id_alloc(this->get_ctx(), this->get_name().c_str(), NULL);
+    transformation_map = isl_map_set_tuple_id(transformation_map, isl_dim_out, id_range);
+
+    DEBUG(3, tiramisu::str_dump("Transformation map : ",
+                                isl_map_to_str(transformation_map)));
+
+    schedule = isl_map_apply_range(isl_map_copy(schedule), isl_map_copy(transformation_map));
+
+    DEBUG(3, tiramisu::str_dump("Schedule after time tiling: ", isl_map_to_str(schedule)));
+
+    this->set_schedule(schedule);
+
+    // The diamonds of a row are independent.
+    this->tag_parallel_level(levels[0] + 1);
+
+    DEBUG_INDENT(-4);
+}
+
+// Function for the buffer class
+
+std::string str_tiramisu_type_op(tiramisu::op_t type)
+{
+    switch (type)
+    {
+    case tiramisu::o_logical_and:
+        return "and";
+    case tiramisu::o_logical_or:
+        return "or";
+    case tiramisu::o_max:
+        return "max";
+    case tiramisu::o_min:
+        return "min";
+    case tiramisu::o_minus:
+        return "minus";
+    case tiramisu::o_add:
+        return "add";
+    case tiramisu::o_sub:
+        return "sub";
+    case tiramisu::o_mul:
+        return "mul";
+    case tiramisu::o_div:
+        return "div";
+    case tiramisu::o_mod:
+        return "mod";
+    case tiramisu::o_select:
+        return "select";
+    case tiramisu::o_lerp:
         return "lerp";
     case tiramisu::o_cond:
         return "ternary_cond";
@@ -5568,7 +6071,8 @@ tiramisu::buffer::buffer(std::string name, std::vector<tiramisu::expr> dim_sizes
                          std::string corr):
                          allocated(false), argtype(argt), auto_allocate(true),
                          automatic_gpu_copy(true), dim_sizes(dim_sizes), fct(fct),
-                         name(name), type(type), location(cuda_ast::memory_location::host)
+                         name(name), type(type), location(cuda_ast::memory_location::host),
+                         numa_first_touch(false), huge_pages(false), node_shared(false)
 {
     assert(!name.empty() && "Empty buffer name");
     assert(fct != NULL && "Input function is NULL");
@@ -6568,6 +7072,11 @@ bool tiramisu::computation::is_wait() const
   return false;
 }
 
+bool tiramisu::computation::is_collective() const
+{
+  return false;
+}
+
 const std::vector<std::pair<std::string, tiramisu::expr>>
         &tiramisu::computation::get_associated_let_stmts() const
 {
@@ -7093,6 +7602,8 @@ std::string tiramisu::xfer_prop::attr_to_string(tiramisu::xfer_attr attr) {
         case CUDA: return "CUDA";
         case BLOCK: return "BLOCK";
         case NONBLOCK: return "NONBLOCK";
+        case RMA_PUT: return "RMA_PUT";
+        case RMA_GET: return "RMA_GET";
         default: {
             assert(false && "Unknown xfer_prop attr specified.");
             return "";
@@ -7155,6 +7666,46 @@ tiramisu::expr tiramisu::communicator::get_num_elements() const
     return num;
 }
 
+void tiramisu::communicator::collapse_strided(int level, tiramisu::expr collapse_from_iter,
+                                              tiramisu::expr num_collapsed, tiramisu::expr stride)
+{
+    assert(!this->is_strided() && "Only one loop level can be collapsed into a strided transfer.");
+    assert(!this->prop.contains_attr(NONBLOCK) && "Strided transfers must be blocking.");
+
+    this->block_count = num_collapsed;
+    this->block_stride = stride;
+    // As in collapse(), the loop is reduced to its first iteration, which
+    // gives the address of the first block.
+    full_loop_level_collapse(level, collapse_from_iter);
+}
+
+bool tiramisu::communicator::is_strided() const
+{
+    return this->block_count.is_defined();
+}
+
+tiramisu::expr tiramisu::communicator::get_block_count() const
+{
+    return this->block_count;
+}
+
+tiramisu::expr tiramisu::communicator::get_block_stride() const
+{
+    return this->block_stride;
+}
+
+void tiramisu::communicator::set_posted()
+{
+    assert(!this->prop.contains_attr(NONBLOCK) && "Only blocking transfers can be posted.");
+
+    this->posted = true;
+}
+
+bool tiramisu::communicator::is_posted() const
+{
+    return this->posted;
+}
+
 xfer_prop tiramisu::communicator::get_xfer_props() const
 {
     return prop;
@@ -7181,7 +7732,11 @@ std::string create_send_func_name(const xfer_prop chan)
 {
     if (chan.contains_attr(MPI)) {
         std::string name = "tiramisu_MPI";
-        if (chan.contains_attr(SYNC) && chan.contains_attr(BLOCK)) {
+        if (chan.contains_attr(RMA_PUT)) {
+            name += "_Put";
+        } else if (chan.contains_attr(RMA_GET)) {
+            name += "_Get";
+        } else if (chan.contains_attr(SYNC) && chan.contains_attr(BLOCK)) {
             name += "_Ssend";
         } else if (chan.contains_attr(SYNC) && chan.contains_attr(NONBLOCK)) {
             name += "_Issend";
@@ -7460,7 +8015,7 @@ tiramisu::send_recv::send_recv(std::string iteration_domain_str, tiramisu::compu
 {
     _is_library_call = true;
     library_call_name = create_send_func_name(prop);
-    if (prop.contains_attr(CPU2GPU)) {
+    if (prop.contains_attr(CPU2GPU) || prop.contains_attr(RMA_PUT) || prop.contains_attr(RMA_GET)) {
         expr mod_rhs(tiramisu::o_address_of, rhs.get_name(), rhs.get_access(), rhs.get_data_type());
         set_expression(mod_rhs);
     } else if (prop.contains_attr(GPU2CPU)) {
@@ -7475,6 +8030,16 @@ bool tiramisu::send_recv::is_send_recv() const
     return true;
 }
 
+tiramisu::expr tiramisu::send_recv::get_peer() const
+{
+    return peer;
+}
+
+void tiramisu::send_recv::set_peer(tiramisu::expr peer)
+{
+    this->peer = peer;
+}
+
 tiramisu::wait::wait(tiramisu::expr rhs, xfer_prop prop, tiramisu::function *fct)
         : communicator(), rhs(rhs) {
     assert(rhs.get_op_type() == tiramisu::o_access && "The RHS expression for a wait should be an access!");
@@ -7517,6 +8082,158 @@ void tiramisu::wait::add_definitions(std::string iteration_domain_str,
     this->updates.push_back(new_c);
 }
 
+tiramisu::computation *tiramisu::computation::create_posted_wait(std::string iteration_domain_str,
+                                                                 tiramisu::function *fct)
+{
+    tiramisu::computation *w = new tiramisu::computation(iteration_domain_str, tiramisu::expr(), true, p_none, fct);
+    w->mark_as_library_call();
+    w->library_call_name = "tiramisu_MPI_Wait_posted";
+    return w;
+}
+
+std::string create_collective_func_name(tiramisu::collective_t op, tiramisu::reduction_t reduction,
+                                        const xfer_prop chan)
+{
+    assert(chan.contains_attr(MPI) && "Collectives must be MPI operations!");
+
+    bool isnonblock = chan.contains_attr(NONBLOCK);
+    std::string name = "tiramisu_MPI_";
+    switch (op) {
+        case ALLREDUCE:
+            name += isnonblock ? "Iallreduce" : "Allreduce";
+            break;
+        case BROADCAST:
+            name += isnonblock ? "Ibcast" : "Bcast";
+            break;
+        case ALLGATHER:
+            name += isnonblock ? "Iallgather" : "Allgather";
+            break;
+        case REDUCE_SCATTER:
+            name += isnonblock ? "Ireduce_scatter" : "Reduce_scatter";
+            break;
+    }
+    if (op == ALLREDUCE || op == REDUCE_SCATTER) {
+        switch (reduction) {
+            case REDUCE_SUM:
+                name += "_sum";
+                break;
+            case REDUCE_MAX:
+                name += "_max";
+                break;
+            case REDUCE_MIN:
+                name += "_min";
+                break;
+        }
+    }
+    switch (chan.get_dtype()) {
+        case p_uint8:
+            name += "_uint8";
+            break;
+        case p_uint16:
+            name += "_uint16";
+            break;
+        case p_uint32:
+            name += "_uint32";
+            break;
+        case p_uint64:
+            name += "_uint64";
+            break;
+        case p_int8:
+            name += "_int8";
+            break;
+        case p_int16:
+            name += "_int16";
+            break;
+        case p_int32:
+            name += "_int32";
+            break;
+        case p_int64:
+            name += "_int64";
+            break;
+        case p_float32:
+            name += "_f32";
+            break;
+        case p_float64:
+            name += "_f64";
+            break;
+        default: {
+            ERROR("Channel not allowed", 27);
+            break;
+        }
+    }
+    return name;
+}
+
+tiramisu::collective::collective(std::string iteration_domain_str, tiramisu::collective_t op,
+                                 tiramisu::reduction_t reduction, tiramisu::expr rhs, tiramisu::expr count,
+                                 xfer_prop prop, tiramisu::function *fct) :
+        communicator(iteration_domain_str, rhs, true, prop.get_dtype(), prop, fct), op(op), reduction(reduction)
+{
+    assert((op == ALLREDUCE || op == REDUCE_SCATTER) && "Only ALLREDUCE and REDUCE_SCATTER take a reduction.");
+
+    this->add_dim(count);
+    this->init_collective(iteration_domain_str, fct);
+}
+
+tiramisu::collective::collective(std::string iteration_domain_str, tiramisu::collective_t op, tiramisu::expr rhs,
+                                 tiramisu::expr count, tiramisu::expr root, xfer_prop prop,
+                                 tiramisu::function *fct) :
+        communicator(iteration_domain_str, rhs, true, prop.get_dtype(), prop, fct), op(op), reduction(REDUCE_SUM),
+        root(root)
+{
+    assert((op == BROADCAST || op == ALLGATHER) && "ALLREDUCE and REDUCE_SCATTER need a reduction.");
+
+    this->add_dim(count);
+    this->init_collective(iteration_domain_str, fct);
+}
+
+void tiramisu::collective::init_collective(std::string iteration_domain_str, tiramisu::function *fct)
+{
+    assert(this->get_expr().get_op_type() == tiramisu::o_access &&
+           "The contribution of a collective should be an access!");
+
+    _is_library_call = true;
+    library_call_name = create_collective_func_name(this->op, this->reduction, this->prop);
+    // As for send, the contribution is passed by address.
+    tiramisu::expr rhs = this->get_expr();
+    expr mod_rhs(tiramisu::o_address_of, rhs.get_name(), rhs.get_access(), rhs.get_data_type());
+    set_expression(mod_rhs);
+
+    if (this->prop.contains_attr(NONBLOCK)) {
+        isl_set *wait_dom = isl_set_read_from_str(this->get_ctx(), iteration_domain_str.c_str());
+        wait_dom = isl_set_set_tuple_name(wait_dom, (this->get_name() + "_wait").c_str());
+        this->wait_comp = create_posted_wait(isl_set_to_str(wait_dom), fct);
+        isl_set_free(wait_dom);
+    }
+}
+
+bool tiramisu::collective::is_collective() const
+{
+    return true;
+}
+
+tiramisu::collective_t tiramisu::collective::get_collective_type() const
+{
+    return this->op;
+}
+
+tiramisu::reduction_t tiramisu::collective::get_reduction() const
+{
+    return this->reduction;
+}
+
+tiramisu::expr tiramisu::collective::get_root() const
+{
+    return this->root;
+}
+
+tiramisu::computation &tiramisu::collective::get_wait() const
+{
+    assert(this->wait_comp != nullptr && "Only nonblocking collectives have a wait.");
+
+    return *this->wait_comp;
+}
+
 void tiramisu::computation::full_loop_level_collapse(int level, tiramisu::expr collapse_from_iter)
 {
     std::string collapse_from_iter_repr;
@@ -7614,6 +8331,16 @@ xfer tiramisu::computation::create_xfer(std::string iter_domain_str, xfer_prop p
     return c;
 }
 
+xfer tiramisu::computation::create_xfer(std::string iter_domain_str, tiramisu::expr peer, xfer_prop prop,
+                                        tiramisu::expr expr, tiramisu::function *fct) {
+    assert(prop.contains_attr(MPI) && (prop.contains_attr(RMA_PUT) || prop.contains_attr(RMA_GET)) &&
+           "A transfer with a peer must be a one-sided MPI transfer (RMA_PUT or RMA_GET).");
+    xfer c = computation::create_xfer(iter_domain_str, prop, expr, fct);
+    c.sr->set_peer(peer);
+
+    return c;
+}
+
 void split_string(std::string str, std::string delimiter, std::vector<std::string> &vector)
 {
     size_t pos = 0;
@@ -7793,7 +8520,15 @@ isl_map* computation::construct_distribution_map(tiramisu::rank_t rank_type)
     this->simplify(this->get_iteration_domain());
     isl_set * it_dom = this->get_trimmed_time_processor_domain();
     project_out_static_dimensions(it_dom);
-    int number_of_ranks = tiramisu::utility::get_extent(it_dom, distributed_dimension);
+    int extent = tiramisu::utility::get_extent(it_dom, distributed_dimension);
+    int first = tiramisu::utility::get_bound(it_dom, distributed_dimension, false).get_int_val();
+
+    tiramisu::distribution_t policy;
+    int block_size;
+    std::vector<int> weights;
+    std::tie(policy, block_size, weights) =
+        this->get_function()->get_distribution_policy(this->get_name(), distributed_dimension);
+    int number_of_ranks = (policy == tiramisu::d_rank) ? extent : weights.size();
 
     std::string dimensions_string = "";
     for (int i = 0; i < dimensions_names.size(); i++)
@@ -7810,7 +8545,52 @@ isl_map* computation::construct_distribution_map(tiramisu::rank_t rank_type)
 
     std::string domain = this->get_name() + "[" + dimensions_string + "]";
 
-    std::string constraint_on_distributed_dimension = rank_name + "<=" + this->get_dimension_name_for_loop_level(distributed_dimension) + "<" + "(" + rank_name + "+1)";
+    std::string dim = this->get_dimension_name_for_loop_level(distributed_dimension);
+    std::string offset = dim + "-" + std::to_string(first);
+    std::string constraint_on_distributed_dimension;
+    switch (policy)
+    {
+        case tiramisu::d_rank:
+            constraint_on_distributed_dimension = rank_name + "<=" + dim + "<" + "(" + rank_name + "+1)";
+            break;
+        case tiramisu::d_block:
+        {
+            std::string block = std::to_string((extent + number_of_ranks - 1) / number_of_ranks);
+            constraint_on_distributed_dimension = block + "*" + rank_name + "<=" + offset + "<" +
+                                                  block + "*" + rank_name + "+" + block;
+            break;
+        }
+        case tiramisu::d_cyclic:
+        case tiramisu::d_block_cyclic:
+            // offset = (k * number_of_ranks + rank) * block_size + e
+            constraint_on_distributed_dimension = "exists (k_dist, e_dist: " + offset + "=" +
+                                                  std::to_string(number_of_ranks * block_size) + "*k_dist+" +
+                                                  std::to_string(block_size) + "*" + rank_name +
+                                                  "+e_dist and 0<=e_dist<" + std::to_string(block_size) + ")";
+            break;
+        case tiramisu::d_weighted:
+        {
+            // The rank r executes [extent * W(r) / W, extent * W(r + 1) / W), W(r)
+            // being the sum of the weights of the ranks before r.
+            long total = 0;
+            for (int w : weights)
+                total += w;
+            assert((total > 0) && "The weights of a weighted distribution should not all be zero.");
+            long prefix = 0;
+            constraint_on_distributed_dimension = "(";
+            for (int r = 0; r < number_of_ranks; r++)
+            {
+                long lower = (extent * prefix) / total;
+                prefix += weights[r];
+                long upper = (extent * prefix) / total;
+                constraint_on_distributed_dimension += std::string(r > 0 ? " or " : "") + "(" + rank_name + "=" +
+                                                       std::to_string(r) + " and " + std::to_string(lower) + "<=" +
+                                                       offset + "<" + std::to_string(upper) + ")";
+            }
+            constraint_on_distributed_dimension += ")";
+            break;
+        }
+    }
 
     std::string distribution_map_string = params + "->{" + domain +"->" + domain + ":"
     + ranks_definition + " and " + constraint_on_distributed_dimension + "}";
@@ -7828,7 +8608,15 @@ std::string computation::get_comm_id(rank_t rank_type, int i)
     return "b_" + this->get_name() + "_" + std::to_string(i) + "_" + get_rank_string_type(rank_type);
 }
 
-isl_set* computation::construct_comm_set(isl_set* set, rank_t rank_type, int comm_id)
+bool computation::has_distribution_policy()
+{
+    int dist_dim = this->get_distributed_dimension();
+
+    return (dist_dim != -1) &&
+           (std::get<0>(this->get_function()->get_distribution_policy(this->get_name(), dist_dim)) != tiramisu::d_rank);
+}
+
+isl_set* computation::construct_comm_set(isl_set* set, rank_t rank_type, int comm_id, bool keep_distributed_dimension)
 {
     int dist_dim = this->get_distributed_dimension();
 
@@ -7857,8 +8645,10 @@ isl_set* computation::construct_comm_set(isl_set* set, rank_t rank_type, int com
     set_parts[0] += " and " + get_rank_string_type(rank_t::r_receiver) + "'=" + get_rank_string_type(rank_t::r_receiver) + "}";
     set = isl_set_read_from_str(isl_set_get_ctx(set), set_parts[0].c_str());
 
-    //Project out the distributed dimension
-    set = isl_set_project_out(set, isl_dim_set, dist_dim + 2, 1);
+    //Project out the distributed dimension, it is the rank unless the computation has a distribution policy
+    //(the set is then in the iteration domain of the producer)
+    if (!keep_distributed_dimension)
+        set = isl_set_project_out(set, isl_dim_set, dist_dim + 2, 1);
 
     //Project out r_receiver from isl_dim_param
     int idx_rrcv= 0;
@@ -7951,36 +8741,191 @@ std::unordered_map<std::string, isl_set*> computation::construct_exchange_sets()
     return to_exchange_sets;
 }
 
-void computation::gen_communication_code(isl_set*recv_iter_dom, isl_set* send_iter_dom, int comm_id, std::string comp_name)
+isl_set* computation::construct_boundary_set()
 {
-    //creating access_variables
-    var r_snd(get_rank_string_type(rank_t::r_sender).c_str());
-    var r_rcv(get_rank_string_type(rank_t::r_receiver).c_str());
+    //construct distribution map of the receiver
+    isl_map* receiver_dist_map = construct_distribution_map(rank_t::r_receiver);
 
-    //creating new iterators
-    std::vector<tiramisu::expr> iterators;
-    int idx = 2;
-    while (idx < isl_set_dim(recv_iter_dom,isl_dim_set) ) {
-        std::string name = generate_new_variable_name();
-        recv_iter_dom = isl_set_set_dim_name(recv_iter_dom, isl_dim_set, idx, name.c_str());
-        send_iter_dom = isl_set_set_dim_name(send_iter_dom, isl_dim_set, idx, name.c_str());
-        iterators.push_back(var(name));
-        idx++;
+    //Find the set that needs to be computed by the receiver
+    isl_set* receiver_to_compute_set = isl_set_apply(isl_set_copy(this->get_trimmed_time_processor_domain()), receiver_dist_map);
+
+    std::vector<isl_map*> rhs_accesses;
+    generator::get_rhs_accesses(this->get_function(), this, rhs_accesses, false);
+
+    isl_set* boundary = isl_set_empty(isl_set_get_space(receiver_to_compute_set));
+
+    for (isl_map* rhs_access : rhs_accesses) {
+        std::string comp_name = isl_map_get_tuple_name(rhs_access, isl_dim_out);
+        computation* producer = get_function()->get_computation_by_name(comp_name)[0];
+        if(producer->get_distributed_dimension() == -1) {
+            isl_map_free(rhs_access);
+            continue;
+        }
+        //apply schedule to consumer and producer
+        rhs_access = isl_map_apply_domain(rhs_access, isl_map_copy(get_trimmed_union_of_schedules()));
+        rhs_access = isl_map_apply_range(rhs_access, isl_map_copy(producer->get_trimmed_union_of_schedules()));
+        //receiver's owned set of the producer
+        isl_map* producer_map = producer->construct_distribution_map(rank_t::r_receiver);
+        isl_set* receiver_owned = isl_set_apply(isl_set_copy(producer->get_trimmed_time_processor_domain()), producer_map);
+        //the iterations of the receiver that read data that it does not own
+        rhs_access = isl_map_intersect_domain(rhs_access, isl_set_copy(receiver_to_compute_set));
+        rhs_access = isl_map_subtract_range(rhs_access, receiver_owned);
+        boundary = isl_set_union(boundary, isl_map_domain(rhs_access));
     }
+    isl_set_free(receiver_to_compute_set);
 
-    //creating access
-    tiramisu::expr access = tiramisu::expr(op_t::o_access, comp_name,iterators,
-    get_function()->get_computation_by_name(comp_name)[0]->get_data_type());
+    //Project out r_receiver from isl_dim_param, the set then holds the boundary of all the ranks
+    int idx_rrcv = isl_set_find_dim_by_name(boundary, isl_dim_param, get_rank_string_type(rank_t::r_receiver).c_str());
+    if (idx_rrcv != -1)
+        boundary = isl_set_project_out(boundary, isl_dim_param, idx_rrcv, 1);
 
-    auto data_type = get_function()->get_computation_by_name(comp_name)[0]->get_data_type();
+    //Go back to the iteration domain
+    boundary = isl_set_apply(boundary, isl_map_reverse(get_trimmed_union_of_schedules()));
 
-    xfer data_transfer = computation::create_xfer(
-        isl_set_to_str(send_iter_dom),
-        isl_set_to_str(recv_iter_dom),
-        r_rcv, r_snd,
-        xfer_prop(data_type, {MPI, BLOCK, ASYNC}),
-        xfer_prop(data_type, {MPI, BLOCK, ASYNC}),
-        access, get_function());
+    DEBUG(3, tiramisu::str_dump("Boundary set:"); isl_set_dump(boundary));
+
+    return isl_set_coalesce(boundary);
+}
+
+isl_set* computation::construct_owned_set(rank_t rank_type)
+{
+    isl_map* dist_map = construct_distribution_map(rank_type);
+    isl_set* owned = isl_set_apply(isl_set_copy(this->get_trimmed_time_processor_domain()), dist_map);
+
+    //Go back to the iteration domain
+    owned = isl_set_apply(owned, isl_map_reverse(get_trimmed_union_of_schedules()));
+
+    return isl_set_coalesce(owned);
+}
+
+isl_set* computation::construct_needed_set(const std::string &comp_name)
+{
+    isl_set* receiver_owned = construct_owned_set(rank_t::r_receiver);
+
+    std::vector<isl_map*> rhs_accesses;
+    generator::get_rhs_accesses(this->get_function(), this, rhs_accesses, false);
+
+    isl_set* needed = nullptr;
+    for (isl_map* rhs_access : rhs_accesses)
+    {
+        if (comp_name != isl_map_get_tuple_name(rhs_access, isl_dim_out))
+        {
+            isl_map_free(rhs_access);
+            continue;
+        }
+        isl_set* read = isl_set_apply(isl_set_copy(receiver_owned), rhs_access);
+        needed = (needed == nullptr) ? read : isl_set_union(needed, read);
+    }
+    isl_set_free(receiver_owned);
+
+    DEBUG(3, tiramisu::str_dump("Needed set of " + comp_name + ":"); if (needed != nullptr) isl_set_dump(needed));
+
+    return (needed == nullptr) ? nullptr : isl_set_coalesce(needed);
+}
+
+xfer computation::gen_root_communication_code(isl_set* set, rank_t rank_type, int root)
+{
+    //The rank becomes the first dimension of the set, root does not send data to itself
+    int idx_rank = isl_set_find_dim_by_name(set, isl_dim_param, get_rank_string_type(rank_type).c_str());
+    assert(idx_rank != -1 && "The set does not depend on the rank.");
+    set = isl_set_move_dims(set, isl_dim_set, 0, isl_dim_param, idx_rank, 1);
+    isl_set* root_only = isl_set_fix_si(isl_set_universe(isl_set_get_space(set)), isl_dim_set, 0, root);
+    set = isl_set_coalesce(isl_set_subtract(set, root_only));
+
+    //The iterators are in this order: root, rank, iterators
+    isl_set* root_set = isl_set_insert_dims(isl_set_copy(set), isl_dim_set, 0, 1);
+    root_set = isl_set_fix_si(root_set, isl_dim_set, 0, root);
+    //The iterators are in this order: rank, root, iterators
+    isl_set* rank_set = isl_set_insert_dims(set, isl_dim_set, 1, 1);
+    rank_set = isl_set_fix_si(rank_set, isl_dim_set, 1, root);
+
+    bool scatter = (rank_type == rank_t::r_receiver);
+    isl_set* send_iter_dom = scatter ? root_set : rank_set;
+    isl_set* recv_iter_dom = scatter ? rank_set : root_set;
+
+    std::string comm_name = "b_" + this->get_name() + (scatter ? "_scatter_" : "_gather_");
+    send_iter_dom = isl_set_set_dim_name(send_iter_dom, isl_dim_set, 0, get_rank_string_type(rank_t::r_sender).c_str());
+    send_iter_dom = isl_set_set_dim_name(send_iter_dom, isl_dim_set, 1, get_rank_string_type(rank_t::r_receiver).c_str());
+    send_iter_dom = isl_set_set_tuple_name(send_iter_dom, (comm_name + get_rank_string_type(rank_t::r_sender)).c_str());
+    recv_iter_dom = isl_set_set_dim_name(recv_iter_dom, isl_dim_set, 0, get_rank_string_type(rank_t::r_receiver).c_str());
+    recv_iter_dom = isl_set_set_dim_name(recv_iter_dom, isl_dim_set, 1, get_rank_string_type(rank_t::r_sender).c_str());
+    recv_iter_dom = isl_set_set_tuple_name(recv_iter_dom, (comm_name + get_rank_string_type(rank_t::r_receiver)).c_str());
+
+    //creating new iterators
+    std::vector<tiramisu::expr> iterators;
+    for (int idx = 2; idx < isl_set_dim(recv_iter_dom, isl_dim_set); idx++)
+    {
+        std::string name = generate_new_variable_name();
+        recv_iter_dom = isl_set_set_dim_name(recv_iter_dom, isl_dim_set, idx, name.c_str());
+        send_iter_dom = isl_set_set_dim_name(send_iter_dom, isl_dim_set, idx, name.c_str());
+        iterators.push_back(var(name));
+    }
+
+    DEBUG(3, tiramisu::str_dump("Send iteration domain:"); isl_set_dump(send_iter_dom));
+    DEBUG(3, tiramisu::str_dump("Receive iteration domain:"); isl_set_dump(recv_iter_dom));
+
+    var r_snd(get_rank_string_type(rank_t::r_sender).c_str());
+    var r_rcv(get_rank_string_type(rank_t::r_receiver).c_str());
+
+    tiramisu::expr access = tiramisu::expr(op_t::o_access, this->get_name(), iterators, this->get_data_type());
+
+    xfer data_transfer = computation::create_xfer(
+        isl_set_to_str(send_iter_dom),
+        isl_set_to_str(recv_iter_dom),
+        r_rcv, r_snd,
+        xfer_prop(this->get_data_type(), {MPI, BLOCK, ASYNC}),
+        xfer_prop(this->get_data_type(), {MPI, BLOCK, ASYNC}),
+        access, get_function());
+
+    data_transfer.s->tag_distribute_level(r_snd);
+    data_transfer.r->tag_distribute_level(r_rcv);
+
+    //The received elements are stored where their owner stores them
+    isl_map *recv_access = isl_map_copy(this->get_access_relation());
+    recv_access = isl_map_insert_dims(recv_access, isl_dim_in, 0, 2);
+    recv_access = isl_map_set_tuple_name(recv_access, isl_dim_in, isl_set_get_tuple_name(recv_iter_dom));
+    data_transfer.r->set_access(recv_access);
+
+    isl_set_free(send_iter_dom);
+    isl_set_free(recv_iter_dom);
+
+    return data_transfer;
+}
+
+xfer computation::gen_communication_code(isl_set*recv_iter_dom, isl_set* send_iter_dom, int comm_id, std::string comp_name,
+                                         bool overlap)
+{
+    //creating access_variables
+    var r_snd(get_rank_string_type(rank_t::r_sender).c_str());
+    var r_rcv(get_rank_string_type(rank_t::r_receiver).c_str());
+
+    //creating new iterators
+    std::vector<tiramisu::expr> iterators;
+    int idx = 2;
+    while (idx < isl_set_dim(recv_iter_dom,isl_dim_set) ) {
+        std::string name = generate_new_variable_name();
+        recv_iter_dom = isl_set_set_dim_name(recv_iter_dom, isl_dim_set, idx, name.c_str());
+        send_iter_dom = isl_set_set_dim_name(send_iter_dom, isl_dim_set, idx, name.c_str());
+        iterators.push_back(var(name));
+        idx++;
+    }
+
+    //The exchanged region is transferred element by element: strided regions are not turned
+    //into vector datatypes here, see communicator::collapse_strided() for hand-written xfers.
+
+    //creating access
+    tiramisu::expr access = tiramisu::expr(op_t::o_access, comp_name,iterators,
+    get_function()->get_computation_by_name(comp_name)[0]->get_data_type());
+
+    auto data_type = get_function()->get_computation_by_name(comp_name)[0]->get_data_type();
+
+    xfer data_transfer = computation::create_xfer(
+        isl_set_to_str(send_iter_dom),
+        isl_set_to_str(recv_iter_dom),
+        r_rcv, r_snd,
+        xfer_prop(data_type, {MPI, BLOCK, ASYNC}),
+        xfer_prop(data_type, {MPI, BLOCK, ASYNC}),
+        access, get_function());
 
     data_transfer.s->tag_distribute_level(r_snd);
     data_transfer.r->tag_distribute_level(r_rcv);
@@ -7991,8 +8936,14 @@ void computation::gen_communication_code(isl_set*recv_iter_dom, isl_set* send_it
     assert(this->get_function()->sched_graph_reversed[this].size() <= 1 &&
             "Node has more than one predecessor.");
 
+    if (overlap)
+    {
+        //gen_communication() schedules the posted communications once they are all created
+        data_transfer.s->set_posted();
+        data_transfer.r->set_posted();
+    }
     //if predecessor
-    if(this->get_predecessor() != nullptr)
+    else if(this->get_predecessor() != nullptr)
     {
          //get level
         int level = this->get_function()->sched_graph_reversed[this][this->get_predecessor()] ;
@@ -8016,6 +8967,19 @@ void computation::gen_communication_code(isl_set*recv_iter_dom, isl_set* send_it
         if(i < iterators.size() - 1) it_string += ',';
     }
 
+    computation *producer = get_function()->get_computation_by_name(comp_name)[0];
+    if (producer->has_distribution_policy())
+    {
+        //The buffers of the producer have the same layout on every rank: the received elements
+        //are stored where their owner stores them
+        isl_map *recv_access = isl_map_copy(producer->get_access_relation());
+        recv_access = isl_map_insert_dims(recv_access, isl_dim_in, 0, 2);
+        recv_access = isl_map_set_tuple_name(recv_access, isl_dim_in, get_comm_id(rank_t::r_receiver, comm_id).c_str());
+        data_transfer.r->set_access(recv_access);
+
+        return data_transfer;
+    }
+
     //Each rank will process dim_extent/nb_ranks
     //To fix and test
     int distributed_dimension = this->get_distributed_dimension();
@@ -8045,33 +9009,134 @@ void computation::gen_communication_code(isl_set*recv_iter_dom, isl_set* send_it
 
     int size = buff->get_dim_sizes()[0].get_int_val() + additional_space;
     buff->set_dim_size(0, size);
+
+    return data_transfer;
 }
 
-void computation::gen_communication()
+void computation::gen_communication(bool overlap)
 {
     int comm_id = 0;
+    std::vector<xfer> transfers;
+
+    //The iterations that read received data, computed before the schedule is changed
+    isl_set* boundary = overlap ? construct_boundary_set() : nullptr;
 
     //Sets that needs to be exchanged between ranks sender, receiver
     std::unordered_map<std::string, isl_set*>  to_receive_sets = construct_exchange_sets ();
 
     for (auto set : to_receive_sets)
     {
-        project_out_static_dimensions(set.second);
+        //With a distribution policy, the elements to exchange are identified by the iterators of the producer
+        computation* producer = get_function()->get_computation_by_name(set.first)[0];
+        bool global_layout = producer->has_distribution_policy();
+        if (global_layout)
+            set.second = isl_set_apply(set.second, isl_map_reverse(isl_map_copy(producer->get_trimmed_union_of_schedules())));
+        else
+            project_out_static_dimensions(set.second);
 
         DEBUG(3, tiramisu::str_dump("To exchange set after project out:"); isl_set_dump(set.second));
 
         if(isl_set_is_empty(set.second)) continue;
 
-        isl_set* recv_iter_dom = construct_comm_set(isl_set_copy(set.second), rank_t::r_receiver, comm_id);
-        isl_set* send_iter_dom = construct_comm_set(set.second, rank_t::r_sender, comm_id);
+        isl_set* recv_iter_dom = construct_comm_set(isl_set_copy(set.second), rank_t::r_receiver, comm_id, global_layout);
+        isl_set* send_iter_dom = construct_comm_set(set.second, rank_t::r_sender, comm_id, global_layout);
 
         DEBUG(3, tiramisu::str_dump("Send iteration domain:"); isl_set_dump(send_iter_dom));
         DEBUG(3, tiramisu::str_dump("Receive iteration domain:"); isl_set_dump(recv_iter_dom));
 
-        gen_communication_code(recv_iter_dom, send_iter_dom, comm_id, set.first);
+        transfers.push_back(gen_communication_code(recv_iter_dom, send_iter_dom, comm_id, set.first, overlap));
 
         comm_id++;
     }
+
+    if (!overlap)
+        return;
+
+    if (transfers.empty())
+    {
+        isl_set_free(boundary);
+        return;
+    }
+
+    function *fct = this->get_function();
+    computation *pred = this->get_predecessor();
+    int level = (pred != nullptr) ? fct->sched_graph_reversed[this][pred] : computation::root;
+
+    //Split the computation into its interior and its boundary
+    computation *boundary_comp = nullptr;
+    if (!isl_set_is_empty(boundary))
+    {
+        std::string domain_str = std::string(isl_set_to_str(this->get_iteration_domain()));
+        this->add_definitions(domain_str,
+            this->get_expr(),
+            this->should_schedule_this_computation(),
+            this->get_data_type(),
+            fct);
+        boundary_comp = &this->get_last_update();
+        boundary_comp->set_schedule(isl_map_copy(this->get_schedule()));
+        if (this->get_access_relation() != NULL)
+            boundary_comp->set_access(isl_map_copy(this->get_access_relation()));
+        boundary_comp->add_schedule_constraint(isl_set_to_str(boundary), "");
+
+        isl_set* interior = isl_set_subtract(isl_set_copy(this->get_iteration_domain()), isl_set_copy(boundary));
+        this->add_schedule_constraint(isl_set_to_str(interior), "");
+        isl_set_free(interior);
+    }
+    isl_set_free(boundary);
+
+    //Wait for the posted communications, once per rank and per iteration of the loops
+    //around the communications
+    int wait_dims = std::max(level, this->get_distributed_dimension()) + 1;
+    isl_set* wait_dom = isl_set_copy(this->get_trimmed_time_processor_domain());
+    project_out_static_dimensions(wait_dom);
+    wait_dom = isl_set_project_out(wait_dom, isl_dim_set, wait_dims, isl_set_dim(wait_dom, isl_dim_set) - wait_dims);
+    bool global_layout = this->has_distribution_policy();
+    if (global_layout)
+    {
+        //A rank owns several iterations of the distributed loop (or none), every rank waits in a single one
+        int dist_dim = this->get_distributed_dimension();
+        wait_dom = isl_set_project_out(wait_dom, isl_dim_set, dist_dim, 1);
+        wait_dom = isl_set_insert_dims(wait_dom, isl_dim_set, dist_dim, 1);
+        wait_dom = isl_set_fix_si(wait_dom, isl_dim_set, dist_dim, 0);
+    }
+    wait_dom = isl_set_set_tuple_name(wait_dom, (this->get_name() + "_wait_posted").c_str());
+    computation *wait_comp = create_posted_wait(isl_set_to_str(wait_dom), fct);
+    isl_set_free(wait_dom);
+    if (!global_layout)
+        wait_comp->tag_distribute_level(this->get_distributed_dimension());
+
+    //Schedule: predecessor, sends, receives, interior, wait, boundary, successors
+    std::unordered_map<computation *, int> successors = fct->sched_graph[this];
+    for (auto &succ : successors)
+    {
+        fct->sched_graph[this].erase(succ.first);
+        fct->sched_graph_reversed[succ.first].erase(this);
+    }
+    if (pred != nullptr)
+    {
+        fct->sched_graph[pred].erase(this);
+        fct->sched_graph_reversed[this].erase(pred);
+    }
+
+    std::vector<computation *> order;
+    for (auto &t : transfers)
+        order.push_back(t.s);
+    for (auto &t : transfers)
+        order.push_back(t.r);
+    order.push_back(this);
+    order.push_back(wait_comp);
+    if (boundary_comp != nullptr)
+        order.push_back(boundary_comp);
+
+    computation *last = pred;
+    for (auto comp : order)
+    {
+        if (last != nullptr)
+            comp->after(*last, level);
+        last = comp;
+    }
+    for (auto &succ : successors)
+        succ.first->after(*last, succ.second);
 }
 
 computation *computation::cache_shared(computation &inp, const var &level,
@@ -8313,4 +9378,806 @@ computation *computation::cache_shared(computation &inp, const var &level,
     return new_access;
 }
 
+computation *computation::cache_local(computation &inp, const var &level,
+                                      std::vector<int> buffer_shape,
+                                      std::vector<expr> copy_offsets,
+                                      bool transpose)
+{
+    DEBUG_FCT_NAME(3);
+    DEBUG_INDENT(4);
+
+    assert(!this->get_name().empty());
+    assert(this->get_function() != NULL);
+
+    function *fn = this->get_function();
+    int n_dims = inp.access_variables.size();
+
+    assert((buffer_shape.empty() || (buffer_shape.size() == n_dims)) &&
+           "Buffer shape should be same as input!");
+    assert((copy_offsets.empty() || (copy_offsets.size() == n_dims)) &&
+           "Copy offsets should be same size as input!");
+
+    // Copy level dimension
+    std::vector<int> dimensions = this->get_loop_level_numbers_from_dimension_names({level.get_name()});
+    assert(dimensions.size() == 1);
+    int copy_level = dimensions[0];
+    this->check_dimensions_validity({copy_level});
+
+    std::vector<std::string> level_names = this->get_loop_level_names();
+    level_names.resize(copy_level + 1);
+
+    if (buffer_shape.empty() || copy_offsets.empty())
+    {
+        // Compute the footprint of the accesses to inp within one iteration
+        // of the copy level: a map from the loop levels enclosing (and
+        // including) the copy level to the elements of inp.
+        std::vector<isl_map *> accesses;
+        generator::get_rhs_accesses(fn, this, accesses, false);
+        isl_map *footprint = NULL;
+        for (auto access : accesses)
+        {
+            if (std::string(isl_map_get_tuple_name(access, isl_dim_out)) != inp.get_name())
+            {
+                isl_map_free(access);
+                continue;
+            }
+            access = isl_map_apply_domain(access, this->get_trimmed_union_of_schedules());
+            footprint = (footprint == NULL) ? access : isl_map_union(footprint, access);
+        }
+        if (footprint == NULL)
+        {
+            ERROR("The computation " + this->get_name() + " does not access " + inp.get_name() + ".", true);
+        }
+
+        // Keep only the dynamic dimensions up to the copy level.
+        int kept = loop_level_into_dynamic_dimension(copy_level);
+        footprint = isl_map_project_out(footprint, isl_dim_in, kept,
+                                        isl_map_dim(footprint, isl_dim_in) - kept);
+        for (int i = copy_level; i >= 0; i--)
+            footprint = isl_map_project_out(footprint, isl_dim_in, 2 * i, 1);
+        for (int i = 0; i <= copy_level; i++)
+            footprint = isl_map_set_dim_name(footprint, isl_dim_in, i, level_names[i].c_str());
+
+        DEBUG(3, tiramisu::str_dump("Footprint of " + inp.get_name() + ": ", isl_map_to_str(footprint)));
+
+        if (buffer_shape.empty())
+        {
+            // Distances between the elements accessed within the same tile.
+            isl_map *same_tile = isl_map_apply_range(isl_map_reverse(isl_map_copy(footprint)),
+                                                     isl_map_copy(footprint));
+            isl_set *deltas = isl_map_deltas(same_tile);
+            for (int i = 0; i < n_dims; i++)
+            {
+                isl_aff *dim_aff = isl_aff_var_on_domain(
+                                       isl_local_space_from_space(isl_set_get_space(deltas)), isl_dim_set, i);
+                isl_val *extent = isl_set_max_val(deltas, dim_aff);
+                isl_aff_free(dim_aff);
+                if (isl_val_is_int(extent) != isl_bool_true)
+                {
+                    ERROR("Cannot compute the footprint of " + inp.get_name() + " at the level " +
+                          level.get_name() + ". Provide the buffer shape explicitly.", true);
+                }
+                buffer_shape.push_back(isl_val_get_num_si(extent) + 1);
+                isl_val_free(extent);
+            }
+            isl_set_free(deltas);
+        }
+
+        if (copy_offsets.empty())
+        {
+            // The offset is the lower bound of the footprint, expressed using
+            // the loop levels enclosing the copy level.
+            for (int i = 0; i < n_dims; i++)
+            {
+                isl_map *dim_footprint = isl_map_copy(footprint);
+                dim_footprint = isl_map_project_out(dim_footprint, isl_dim_out, i + 1, n_dims - i - 1);
+                dim_footprint = isl_map_project_out(dim_footprint, isl_dim_out, 0, i);
+                isl_set *bounds = isl_set_flatten(isl_map_wrap(dim_footprint));
+                for (int l = 0; l <= copy_level; l++)
+                    bounds = isl_set_set_dim_name(bounds, isl_dim_set, l, level_names[l].c_str());
+                bounds = isl_set_set_dim_name(bounds, isl_dim_set, copy_level + 1,
+                                              generate_new_variable_name().c_str());
+                copy_offsets.push_back(utility::get_bound(bounds, copy_level + 1, false));
+                isl_set_free(bounds);
+            }
+        }
+
+        isl_map_free(footprint);
+    }
+
+    DEBUG_NO_NEWLINE(3, tiramisu::str_dump("Local buffer shape: "));
+    for (int i = 0; i < n_dims; i++)
+    {
+        DEBUG_NO_NEWLINE_NO_INDENT(3, tiramisu::str_dump(std::to_string(buffer_shape[i]) + " "));
+    }
+    DEBUG_NEWLINE(3);
+
+    // The dimensions of the local buffer, in the order in which they are
+    // stored.
+    std::vector<int> order(n_dims);
+    for (int i = 0; i < n_dims; i++)
+        order[i] = i;
+    if (transpose && (n_dims >= 2))
+        std::swap(order[n_dims - 1], order[n_dims - 2]);
+
+    // Create local buffer
+    std::string name_prefix = "_" + this->get_name() + "_" + inp.get_name();
+    std::vector<expr> buff_shape;
+    for (int i = 0; i < n_dims; i++)
+        buff_shape.push_back(buffer_shape[order[i]]);
+    buffer *buff = new buffer(name_prefix + "_local",
+            buff_shape, inp.get_data_type(), a_temporary, fn);
+    // The buffer is allocated at the copy level.
+    buff->set_auto_allocate(false);
+
+    // Create new access computation and replace mapping
+    std::vector<var> access_variables;
+    std::vector<expr> access_exprs;
+    for (int i = 0; i < n_dims; i++)
+        access_variables.push_back(var(inp.access_variables[i].second, false));
+    for (int i = 0; i < n_dims; i++)
+        access_exprs.push_back(access_variables[order[i]] % buffer_shape[order[i]]);
+    input *new_access = new input(name_prefix + "_local_access", access_variables, inp.get_data_type());
+    new_access->store_in(buff, access_exprs);
+    this->set_expression(this->expression.substitute_access(inp.get_name(), new_access->get_name()));
+
+    // Construct iteration domain for copy
+    isl_set *copy_domain = isl_map_range(isl_map_copy(this->get_schedule()));
+    // Project out redundancy dimension
+    copy_domain = isl_set_project_out(copy_domain, isl_dim_set, 0, 1);
+    std::string copy_name = name_prefix + "_local_copy";
+    copy_domain = isl_set_set_tuple_name(copy_domain, copy_name.c_str());
+    project_out_static_dimensions(copy_domain);
+    // Project out dimensions under copy_level
+    copy_domain = isl_set_project_out(copy_domain, isl_dim_set, copy_level + 1,
+            isl_set_dim(copy_domain, isl_dim_set) - copy_level - 1);
+    for (int i = 0; i <= copy_level; i++)
+        copy_domain = isl_set_set_dim_name(copy_domain, isl_dim_set, i, level_names[i].c_str());
+    isl_set *dec_domain = isl_set_copy(copy_domain);
+
+    // Add one copy loop for each dimension of the input
+    std::vector<std::string> copy_iter_names;
+    copy_domain = isl_set_add_dims(copy_domain, isl_dim_set, n_dims);
+    for (int i = 0; i < n_dims; i++)
+    {
+        int pos = copy_level + 1 + i;
+        copy_iter_names.push_back(name_prefix + "_c" + std::to_string(i));
+        copy_domain = isl_set_set_dim_name(copy_domain, isl_dim_set, pos, copy_iter_names[i].c_str());
+        isl_constraint *cst1 = isl_constraint_alloc_inequality(isl_local_space_from_space(isl_set_get_space(copy_domain)));
+        cst1 = isl_constraint_set_coefficient_si(cst1, isl_dim_set, pos, 1);
+        copy_domain = isl_set_add_constraint(copy_domain, cst1);
+        isl_constraint *cst2 = isl_constraint_alloc_inequality(isl_local_space_from_space(isl_set_get_space(copy_domain)));
+        cst2 = isl_constraint_set_coefficient_si(cst2, isl_dim_set, pos, -1);
+        cst2 = isl_constraint_set_constant_si(cst2, buffer_shape[i] - 1);
+        copy_domain = isl_set_add_constraint(copy_domain, cst2);
+    }
+    copy_domain = isl_set_set_tuple_name(copy_domain, copy_name.c_str());
+
+    // Clip the copy to the iteration domain of inp so that partial tiles do
+    // not read out of bounds.
+    {
+        std::string params = utility::get_parameters_list(copy_domain);
+        std::string inp_params = utility::get_parameters_list(inp.get_iteration_domain());
+        if (!inp_params.empty())
+            params = params.empty() ? inp_params : params + "," + inp_params;
+        std::string clip_str = "[" + params + "] -> {" + copy_name + "[";
+        for (int i = 0; i < isl_set_dim(copy_domain, isl_dim_set); i++)
+            clip_str += std::string(i == 0 ? "" : ", ") + isl_set_get_dim_name(copy_domain, isl_dim_set, i);
+        clip_str += "] -> " + inp.get_name() + "[";
+        for (int i = 0; i < n_dims; i++)
+            clip_str += std::string(i == 0 ? "" : ", ") + copy_iter_names[i] + " + (" + copy_offsets[i].to_str() + ")";
+        clip_str += "]}";
+        DEBUG(3, tiramisu::str_dump("Clipping map: " + clip_str));
+        isl_map *clip = isl_map_read_from_str(this->get_ctx(), clip_str.c_str());
+        if (clip != NULL)
+        {
+            clip = isl_map_intersect_range(clip, isl_set_copy(inp.get_iteration_domain()));
+            copy_domain = isl_set_intersect(copy_domain, isl_map_domain(clip));
+            copy_domain = isl_set_set_tuple_name(copy_domain, copy_name.c_str());
+        }
+        else
+        {
+            DEBUG(3, tiramisu::str_dump("The copy offsets are not affine, the copy is not clipped."));
+        }
+    }
+
+    // Create access patterns for the local buffer and input computation
+    std::vector<expr> buf_access;
+    std::vector<expr> inp_access;
+    for (int i = 0; i < n_dims; i++)
+        inp_access.push_back(var(copy_iter_names[i], false) + copy_offsets[i]);
+    for (int i = 0; i < n_dims; i++)
+        buf_access.push_back(inp_access[order[i]] % buffer_shape[order[i]]);
+
+    // Create the copy computation
+    std::string copy_domain_str = isl_set_to_str(copy_domain);
+    DEBUG(3, tiramisu::str_dump("Generated iteration domain for copy: " + copy_domain_str));
+    computation *copy_computation = new computation(copy_domain_str,
+            expr(o_access, inp.get_name(), inp_access, inp.get_data_type()),
+            true, inp.get_data_type(), fn);
+    copy_computation->store_in(buff, buf_access);
+    isl_set_free(copy_domain);
+
+    // Declare buffer
+    std::string dec_name = name_prefix + "_local_dec";
+    dec_domain = isl_set_set_tuple_name(dec_domain, dec_name.c_str());
+    std::string dec_domain_str = isl_set_to_str(dec_domain);
+    DEBUG(3, tiramisu::str_dump("Generated iteration domain for declaration: " + dec_domain_str));
+    computation *buf_dec = new computation(dec_domain_str, allocate(*buff), true, p_none, fn);
+    isl_set_free(dec_domain);
+
+    // Schedule computations
+    {
+        // Traverse schedule tree up and find the first computation in the given level
+        computation *curr = this;
+        computation *pred = curr->get_predecessor();
+        while (pred != nullptr && fn->sched_graph[pred][curr] >= copy_level) {
+            curr = pred;
+            pred = curr->get_predecessor();
+        }
+        // Schedule
+        if (pred != nullptr) {
+            buf_dec->between(*pred, fn->sched_graph[pred][curr], *curr, copy_level);
+        } else {
+            buf_dec->before(*curr, copy_level);
+        }
+        copy_computation->between(*buf_dec, copy_level, *curr, copy_level);
+    }
+
+    // Vectorize the innermost copy loop (loads from inp are contiguous
+    // along that loop).
+    int vector_length = 32 / halide_type_from_tiramisu_type(inp.get_data_type()).bytes();
+    if (buffer_shape[n_dims - 1] >= vector_length)
+        copy_computation->vectorize(var(copy_iter_names[n_dims - 1], false), vector_length);
+
+    DEBUG_INDENT(-4);
+
+    return new_access;
+}
+
+/**
+  * Return the identity element of the reduction operator \p op for
+  * values of type \p T.
+  */
+template <typename T>
+static T reduction_identity_value(tiramisu::op_t op)
+{
+    switch (op)
+    {
+        case tiramisu::o_add:
+            return (T) 0;
+        case tiramisu::o_mul:
+            return (T) 1;
+        case tiramisu::o_max:
+            return std::numeric_limits<T>::lowest();
+        case tiramisu::o_min:
+            return std::numeric_limits<T>::max();
+        default:
+            ERROR("Unsupported reduction operator.", true);
+    }
+    return (T) 0;
+}
+
+static tiramisu::expr reduction_identity(tiramisu::op_t op, tiramisu::primitive_t type)
+{
+    switch (type)
+    {
+        case tiramisu::p_uint8:
+            return tiramisu::expr(reduction_identity_value<uint8_t>(op));
+        case tiramisu::p_int8:
+            return tiramisu::expr(reduction_identity_value<int8_t>(op));
+        case tiramisu::p_uint16:
+            return tiramisu::expr(reduction_identity_value<uint16_t>(op));
+        case tiramisu::p_int16:
+            return tiramisu::expr(reduction_identity_value<int16_t>(op));
+        case tiramisu::p_uint32:
+            return tiramisu::expr(reduction_identity_value<uint32_t>(op));
+        case tiramisu::p_int32:
+            return tiramisu::expr(reduction_identity_value<int32_t>(op));
+        case tiramisu::p_uint64:
+            return tiramisu::expr(reduction_identity_value<uint64_t>(op));
+        case tiramisu::p_int64:
+            return tiramisu::expr(reduction_identity_value<int64_t>(op));
+        case tiramisu::p_float32:
+            return tiramisu::expr(reduction_identity_value<float>(op));
+        case tiramisu::p_float64:
+            return tiramisu::expr(reduction_identity_value<double>(op));
+        default:
+            ERROR("Unsupported reduction type: " + str_from_tiramisu_type_primitive(type), true);
+    }
+    return tiramisu::expr();
+}
+
+/**
+  * Return the map from the iterations of \p comp to the values of its
+  * loop level \p level: {C[i,j] -> C[l]}.
+  */
+static isl_map *get_loop_level_values(tiramisu::computation *comp, int level)
+{
+    int l_dim = loop_level_into_dynamic_dimension(level);
+    isl_map *lmap = isl_map_copy(comp->get_schedule());
+    lmap = isl_map_intersect_domain(lmap, isl_set_copy(comp->get_iteration_domain()));
+    lmap = isl_map_project_out(lmap, isl_dim_out, l_dim + 1, isl_map_dim(lmap, isl_dim_out) - l_dim - 1);
+    lmap = isl_map_project_out(lmap, isl_dim_out, 0, l_dim);
+    lmap = isl_map_set_tuple_name(lmap, isl_dim_out, comp->get_name().c_str());
+    return lmap;
+}
+
+/**
+  * Return the lower (or upper if \p upper is true) bound of the dimension
+  * \p dim of \p set.  The result is not an integer if the bound is not
+  * constant.
+  */
+static isl_val *get_constant_bound(isl_set *set, int dim, bool upper)
+{
+    isl_aff *aff = isl_aff_var_on_domain(isl_local_space_from_space(isl_set_get_space(set)), isl_dim_set, dim);
+    isl_val *bound = upper ? isl_set_max_val(set, aff) : isl_set_min_val(set, aff);
+    isl_aff_free(aff);
+    return bound;
+}
+
+computation *computation::rfactor(tiramisu::var L)
+{
+    DEBUG_FCT_NAME(3);
+    DEBUG_INDENT(4);
+
+    assert(L.get_name().length() > 0);
+    assert(this->get_function() != NULL);
+
+    function *fn = this->get_function();
+
+    std::vector<int> dimensions = this->get_loop_level_numbers_from_dimension_names({L.get_name()});
+    assert(dimensions.size() == 1);
+    int level = dimensions[0];
+    this->check_dimensions_validity({level});
+
+    if (this->get_access_relation() == NULL)
+    {
+        ERROR("The computation " + this->get_name() + " should be mapped to a buffer before calling rfactor().", true);
+    }
+
+    // Find the reduction operator and the value being accumulated.
+    tiramisu::expr e = this->get_expr();
+    if ((e.get_expr_type() != tiramisu::e_op) ||
+        ((e.get_op_type() != tiramisu::o_add) && (e.get_op_type() != tiramisu::o_mul) &&
+         (e.get_op_type() != tiramisu::o_max) && (e.get_op_type() != tiramisu::o_min)))
+    {
+        ERROR("The expression of " + this->get_name() + " is not a reduction (+, *, max or min).", true);
+    }
+    tiramisu::op_t op = e.get_op_type();
+    // The operand that reads the element being updated is an access to this
+    // computation or to another computation stored in the same buffer.
+    int self_operand = -1;
+    for (int i = 0; (i < 2) && (self_operand == -1); i++)
+    {
+        const tiramisu::expr &operand = e.get_operand(i);
+        if ((operand.get_expr_type() != tiramisu::e_op) || (operand.get_op_type() != tiramisu::o_access))
+            continue;
+        std::vector<computation *> accessed = fn->get_computation_by_name(operand.get_name());
+        if ((operand.get_name() == this->get_name()) ||
+            (!accessed.empty() && (accessed[0]->get_buffer() == this->get_buffer())))
+            self_operand = i;
+    }
+    if (self_operand == -1)
+    {
+        ERROR("The expression of " + this->get_name() + " does not update " + this->get_name() + ".", true);
+    }
+    tiramisu::expr self_access = e.get_operand(self_operand);
+    tiramisu::expr value = e.get_operand(1 - self_operand);
+
+    // Map each iteration to the value of the loop level L.
+    isl_map *lmap = get_loop_level_values(this, level);
+
+    DEBUG(3, tiramisu::str_dump("Partial reduction index: ", isl_map_to_str(lmap)));
+
+    // Extent of the partial accumulator dimension.
+    isl_set *l_values = isl_map_range(isl_map_copy(lmap));
+    l_values = isl_set_set_dim_name(l_values, isl_dim_set, 0, generate_new_variable_name().c_str());
+    isl_val *l_min = get_constant_bound(l_values, 0, false);
+    if (isl_val_is_int(l_min) != isl_bool_true)
+    {
+        ERROR("The lower bound of the loop level " + L.get_name() + " should be a constant.", true);
+    }
+    int l_offset = isl_val_get_num_si(l_min);
+    isl_val_free(l_min);
+    tiramisu::expr l_extent;
+    isl_val *l_max = get_constant_bound(l_values, 0, true);
+    if (isl_val_is_int(l_max) == isl_bool_true)
+        l_extent = tiramisu::expr((int32_t) (isl_val_get_num_si(l_max) - l_offset + 1));
+    else
+        l_extent = utility::get_bound(l_values, 0, true) - l_offset + 1;
+    isl_val_free(l_max);
+    isl_set_free(l_values);
+
+    // One partial accumulator per element of the output and per value of L.
+    // L is the outermost dimension: the partial accumulators of a value of L
+    // are contiguous, so the threads of a parallel L do not false-share.
+    std::string part_name = "_" + this->get_name() + "_rf";
+    buffer *out_buff = this->get_buffer();
+    std::vector<tiramisu::expr> part_sizes = {l_extent};
+    for (const auto &size : out_buff->get_dim_sizes())
+        part_sizes.push_back(size);
+    // A copy of a small output would still share its cache line with the
+    // copies of the neighbouring values of L: pad the innermost dimension
+    // so that each copy covers whole cache lines.
+    if (out_buff->has_constant_extents() && (part_sizes.size() > 1))
+    {
+        const long cache_line = 64;
+        long line_elems = std::max(1L, cache_line / halide_type_from_tiramisu_type(this->get_data_type()).bytes());
+        long outer = 1;
+        for (size_t i = 1; i + 1 < part_sizes.size(); i++)
+            outer *= part_sizes[i].get_int_val();
+        long inner = part_sizes.back().get_int_val();
+        if (outer * inner < line_elems)
+        {
+            while ((outer * inner) % line_elems != 0)
+                inner++;
+            part_sizes.back() = tiramisu::expr((int32_t) inner);
+        }
+    }
+    buffer *part_buff = new buffer(part_name + "_buf", part_sizes, this->get_data_type(), a_temporary, fn);
+
+    isl_map *part_access = isl_map_range_product(isl_map_copy(lmap), isl_map_copy(this->get_access_relation()));
+    part_access = isl_map_flatten_range(part_access);
+    {
+        int n_out = isl_map_dim(part_access, isl_dim_out);
+        std::string shift_str = "{" + part_buff->get_name() + "[";
+        std::string shifted = part_buff->get_name() + "[";
+        for (int i = 0; i < n_out; i++)
+        {
+            std::string d = "d" + std::to_string(i);
+            shift_str += std::string(i == 0 ? "" : ", ") + d;
+            shifted += std::string(i == 0 ? "" : ", ") + d +
+                       ((i == 0) ? " - (" + std::to_string(l_offset) + ")" : "");
+        }
+        shift_str += "] -> " + shifted + "]}";
+        part_access = isl_map_set_tuple_name(part_access, isl_dim_out, part_buff->get_name().c_str());
+        part_access = isl_map_apply_range(part_access, isl_map_read_from_str(this->get_ctx(), shift_str.c_str()));
+    }
+
+    DEBUG(3, tiramisu::str_dump("Access to the partial accumulators: ", isl_map_to_str(part_access)));
+
+    // The iterations of this computation that combine the partial
+    // accumulators: one per partial accumulator (the lexicographically
+    // first iteration that updates it).
+    isl_map *owner = isl_map_range_product(isl_map_copy(this->get_access_relation()), isl_map_copy(lmap));
+    owner = isl_map_intersect_domain(owner, isl_set_copy(this->get_iteration_domain()));
+    isl_set *combine_domain = isl_map_range(isl_map_lexmin(isl_map_reverse(owner)));
+    combine_domain = isl_set_coalesce(combine_domain);
+    isl_map_free(lmap);
+
+    DEBUG(3, tiramisu::str_dump("Combine domain: ", isl_set_to_str(combine_domain)));
+
+    // Partial accesses use the iterators of this computation.
+    std::vector<tiramisu::expr> iterators;
+    for (int i = 0; i < isl_set_dim(this->get_iteration_domain(), isl_dim_set); i++)
+        iterators.push_back(tiramisu::var(isl_set_get_dim_name(this->get_iteration_domain(), isl_dim_set, i), false));
+
+    // Partial reduction.
+    std::string update_name = part_name + "_update";
+    isl_set *update_domain = isl_set_set_tuple_name(isl_set_copy(this->get_iteration_domain()), update_name.c_str());
+    tiramisu::expr partial = tiramisu::expr(o_access, update_name, iterators, this->get_data_type());
+    computation *update = new computation(isl_set_to_str(update_domain),
+                                          tiramisu::expr(op, partial, value),
+                                          true, this->get_data_type(), fn);
+    isl_set_free(update_domain);
+    isl_map *update_schedule = isl_map_copy(this->get_schedule());
+    update_schedule = isl_map_set_tuple_name(update_schedule, isl_dim_in, update_name.c_str());
+    update_schedule = isl_map_set_tuple_name(update_schedule, isl_dim_out, update_name.c_str());
+    update->set_schedule(update_schedule);
+    isl_map *update_access = isl_map_set_tuple_name(isl_map_copy(part_access), isl_dim_in, update_name.c_str());
+    update->set_access(update_access);
+    isl_map_free(update_access);
+
+    // Initialization of the partial accumulators.
+    std::string init_name = part_name + "_init";
+    isl_set *init_domain = isl_set_set_tuple_name(isl_set_copy(combine_domain), init_name.c_str());
+    computation *init = new computation(isl_set_to_str(init_domain),
+                                        reduction_identity(op, this->get_data_type()),
+                                        true, this->get_data_type(), fn);
+    isl_set_free(init_domain);
+    isl_map *init_schedule = isl_map_intersect_domain(isl_map_copy(this->get_schedule()),
+                                                      isl_set_copy(combine_domain));
+    init_schedule = isl_map_set_tuple_name(init_schedule, isl_dim_in, init_name.c_str());
+    init_schedule = isl_map_set_tuple_name(init_schedule, isl_dim_out, init_name.c_str());
+    init->set_schedule(init_schedule);
+    isl_map *init_access = isl_map_set_tuple_name(isl_map_copy(part_access), isl_dim_in, init_name.c_str());
+    init->set_access(init_access);
+    isl_map_free(init_access);
+    isl_map_free(part_access);
+
+    // This computation becomes the combination of the partial accumulators
+    // into the output.
+    this->set_iteration_domain(combine_domain);
+    this->set_schedule(isl_map_intersect_domain(isl_map_copy(this->get_schedule()),
+                                                isl_set_copy(combine_domain)));
+    this->set_expression(tiramisu::expr(op, self_access,
+                                        tiramisu::expr(o_access, update_name, iterators, this->get_data_type())));
+
+    // Order the stages: init, partial reduction, then combination.
+    computation *pred = this->get_predecessor();
+    if (pred != nullptr)
+        init->between(*pred, fn->sched_graph[pred][this], *this, computation::root_dimension);
+    else
+        init->before(*this, computation::root_dimension);
+    update->between(*init, computation::root_dimension, *this, computation::root_dimension);
+
+    DEBUG_INDENT(-4);
+
+    return update;
+}
+
+computation *computation::parallelize_update(tiramisu::var L, tiramisu::update_strategy_t strategy)
+{
+    DEBUG_FCT_NAME(3);
+    DEBUG_INDENT(4);
+
+    assert(L.get_name().length() > 0);
+    assert(this->get_function() != NULL);
+
+    std::vector<int> dimensions = this->get_loop_level_numbers_from_dimension_names({L.get_name()});
+    assert(dimensions.size() == 1);
+    int level = dimensions[0];
+    this->check_dimensions_validity({level});
+
+    if (strategy == tiramisu::u_auto)
+    {
+        // Privatization costs one copy of the output per iteration of L
+        // (allocation, initialization and merge), while atomic updates make
+        // each update slower, especially when the parallel iterations
+        // update the same elements.  Privatize if the copies fit in the
+        // cache and each of their elements is updated several times.
+        const long privatization_budget = 1 << 20;
+        const long min_updates_per_element = 4;
+
+        strategy = tiramisu::u_atomic;
+        buffer *out_buff = this->get_buffer();
+        if ((out_buff != nullptr) && out_buff->has_constant_extents())
+        {
+            long out_elements = 1;
+            for (const auto &size : out_buff->get_dim_sizes())
+                out_elements *= size.get_int_val();
+
+            // Number of updates, approximated by the bounding box of the
+            // iteration domain.
+            long updates = 1;
+            isl_set *domain = this->get_iteration_domain();
+            for (int i = 0; (i < isl_set_dim(domain, isl_dim_set)) && (updates > 0); i++)
+            {
+                isl_val *lb = get_constant_bound(domain, i, false);
+                isl_val *ub = get_constant_bound(domain, i, true);
+                if ((isl_val_is_int(lb) == isl_bool_true) && (isl_val_is_int(ub) == isl_bool_true))
+                    updates *= isl_val_get_num_si(ub) - isl_val_get_num_si(lb) + 1;
+                else
+                    updates = -1;
+                isl_val_free(lb);
+                isl_val_free(ub);
+            }
+
+            long copies = -1;
+            isl_set *l_values = isl_map_range(get_loop_level_values(this, level));
+            isl_val *lb = get_constant_bound(l_values, 0, false);
+            isl_val *ub = get_constant_bound(l_values, 0, true);
+            if ((isl_val_is_int(lb) == isl_bool_true) && (isl_val_is_int(ub) == isl_bool_true))
+                copies = isl_val_get_num_si(ub) - isl_val_get_num_si(lb) + 1;
+            isl_val_free(lb);
+            isl_val_free(ub);
+            isl_set_free(l_values);
+
+            long copies_bytes = copies * out_elements *
+                                halide_type_from_tiramisu_type(this->get_data_type()).bytes();
+
+            DEBUG(3, tiramisu::str_dump("Number of updates: " + std::to_string(updates) +
+                                        ", private copies: " + std::to_string(copies) +
+                                        " of " + std::to_string(out_elements) + " elements."));
+
+            if ((updates > 0) && (copies > 0) && (copies_bytes <= privatization_budget) &&
+                (updates >= min_updates_per_element * copies * out_elements))
+                strategy = tiramisu::u_privatize;
+        }
+    }
+
+    computation *parallel_comp = this;
+    if (strategy == tiramisu::u_privatize)
+    {
+        DEBUG(3, tiramisu::str_dump("Privatizing the updates of " + this->get_name()));
+        parallel_comp = this->rfactor(L);
+    }
+    else
+    {
+        DEBUG(3, tiramisu::str_dump("Using atomic updates for " + this->get_name()));
+        this->tag_atomic_update();
+    }
+    parallel_comp->parallelize(L);
+
+    DEBUG_INDENT(-4);
+
+    return parallel_comp;
+}
+
+isl_set *computation::get_self_dependence_distances(int L0, int L1)
+{
+    DEBUG_FCT_NAME(3);
+    DEBUG_INDENT(4);
+
+    assert(L0 < L1);
+
+    // Dependences {C[source] -> C[sink]} of this computation on itself.
+    std::vector<isl_map *> accesses;
+    generator::get_rhs_accesses(this->get_function(), this, accesses, false);
+    isl_map *deps = NULL;
+    for (auto access : accesses)
+    {
+        if (std::string(isl_map_get_tuple_name(access, isl_dim_out)) != this->get_name())
+        {
+            isl_map_free(access);
+            continue;
+        }
+        isl_map *dep = isl_map_reverse(access);
+        dep = isl_map_intersect_domain(dep, isl_set_copy(this->get_iteration_domain()));
+        dep = isl_map_intersect_range(dep, isl_set_copy(this->get_iteration_domain()));
+        deps = (deps == NULL) ? dep : isl_map_union(deps, dep);
+    }
+
+    int dim0 = loop_level_into_dynamic_dimension(L0);
+    int dim1 = loop_level_into_dynamic_dimension(L1);
+
+    if (deps == NULL)
+    {
+        DEBUG(3, tiramisu::str_dump("The computation does not depend on itself."));
+        DEBUG_INDENT(-4);
+        return isl_set_empty(isl_space_set_alloc(this->get_ctx(), 0, 2));
+    }
+
+    // Distances in the time-space domain.
+    deps = isl_map_apply_domain(deps, isl_map_copy(this->get_schedule()));
+    deps = isl_map_apply_range(deps, isl_map_copy(this->get_schedule()));
+    isl_set *distances = isl_map_deltas(deps);
+
+    // Keep the dependences that are not carried by the outer loop levels.
+    for (int l = 0; l < L0; l++)
+    {
+        distances = isl_set_fix_si(distances, isl_dim_set, loop_level_into_dynamic_dimension(l), 0);
+    }
+    int n_dims = isl_set_dim(distances, isl_dim_set);
+    distances = isl_set_project_out(distances, isl_dim_set, dim1 + 1, n_dims - dim1 - 1);
+    distances = isl_set_project_out(distances, isl_dim_set, dim0 + 1, dim1 - dim0 - 1);
+    distances = isl_set_project_out(distances, isl_dim_set, 0, dim0);
+    distances = isl_set_coalesce(distances);
+
+    DEBUG(3, tiramisu::str_dump("Dependence distances: ", isl_set_to_str(distances)));
+
+    DEBUG_INDENT(-4);
+
+    return distances;
+}
+
+void computation::wavefront(tiramisu::var L0, tiramisu::var L1)
+{
+    DEBUG_FCT_NAME(3);
+    DEBUG_INDENT(4);
+
+    this->wavefront(L0, L1, tiramisu::var(generate_new_variable_name()),
+                    tiramisu::var(generate_new_variable_name()));
+
+    DEBUG_INDENT(-4);
+}
+
+void computation::wavefront(tiramisu::var L0, tiramisu::var L1, tiramisu::var W, tiramisu::var P)
+{
+    DEBUG_FCT_NAME(3);
+    DEBUG_INDENT(4);
+
+    assert(L0.get_name().length() > 0);
+    assert(L1.get_name().length() > 0);
+
+    std::vector<int> dimensions =
+        this->get_loop_level_numbers_from_dimension_names({L0.get_name(), L1.get_name()});
+    this->check_dimensions_validity(dimensions);
+    if (dimensions[0] + 1 != dimensions[1])
+    {
+        ERROR("Loop levels passed to wavefront() should be consecutive. The first argument to wavefront() should be the outer loop level.", true);
+    }
+
+    isl_set *distances = this->get_self_dependence_distances(dimensions[0], dimensions[1]);
+
+    // Find the smallest factor f such that f*d0 + d1 > 0 for all the
+    // dependences carried by L0 (the dependences carried by L1 already
+    // satisfy it).
+    const int max_factor = 64;
+    int factor = 1;
+    for (; factor <= max_factor; factor++)
+    {
+        std::string violated_str = "{[d0, d1] : d0 > 0 and " + std::to_string(factor) + "*d0 + d1 <= 0}";
+        isl_set *violated = isl_set_read_from_str(this->get_ctx(), violated_str.c_str());
+        violated = isl_set_intersect(violated, isl_set_reset_tuple_id(isl_set_copy(distances)));
+        bool legal = (isl_set_is_empty(violated) == isl_bool_true);
+        isl_set_free(violated);
+        if (legal)
+        {
+            break;
+        }
+    }
+    isl_set_free(distances);
+    if (factor > max_factor)
+    {
+        ERROR("Cannot find a skewing factor that makes the loop level " + L1.get_name() +
+              " parallel: the dependences of " + this->get_name() + " have unbounded distances.", true);
+    }
+
+    DEBUG(3, tiramisu::str_dump("Skewing factor: " + std::to_string(factor)));
+
+    // (L0, L1) -> (P, W) = (L0, f*L0 + L1) -> (W, P)
+    this->skew(L0, L1, factor, P, W);
+    this->interchange(P, W);
+    this->tag_parallel_level(P);
+
+    DEBUG_INDENT(-4);
+}
+
+void computation::wavefront_pipeline(tiramisu::var L0, tiramisu::var L1)
+{
+    DEBUG_FCT_NAME(3);
+    DEBUG_INDENT(4);
+
+    assert(L0.get_name().length() > 0);
+    assert(L1.get_name().length() > 0);
+
+    std::vector<int> dimensions =
+        this->get_loop_level_numbers_from_dimension_names({L0.get_name(), L1.get_name()});
+    this->check_dimensions_validity(dimensions);
+    if (dimensions[0] + 1 != dimensions[1])
+    {
+        ERROR("Loop levels passed to wavefront_pipeline() should be consecutive. The first argument to wavefront_pipeline() should be the outer loop level.", true);
+    }
+
+    isl_set *distances = this->get_self_dependence_distances(dimensions[0], dimensions[1]);
+    distances = isl_set_reset_tuple_id(distances);
+    isl_set *carried = isl_set_intersect(isl_set_copy(distances),
+                                         isl_set_read_from_str(this->get_ctx(), "{[d0, d1] : d0 > 0}"));
+    isl_set_free(distances);
+
+    // For each distance k along L0, the iteration j of L1 waits for the
+    // iteration j - min(d1) of the iteration i - k of L0.
+    std::vector<std::pair<int, int>> lags;
+    if (isl_set_is_empty(carried) != isl_bool_true)
+    {
+        isl_val *max_distance = get_constant_bound(carried, 0, true);
+        if (isl_val_is_int(max_distance) != isl_bool_true)
+        {
+            ERROR("The dependences of " + this->get_name() + " along " + L0.get_name() +
+                  " should have a bounded distance.", true);
+        }
+        int max_k = isl_val_get_num_si(max_distance);
+        isl_val_free(max_distance);
+        for (int k = 1; k <= max_k; k++)
+        {
+            isl_set *slice = isl_set_fix_si(isl_set_copy(carried), isl_dim_set, 0, k);
+            if (isl_set_is_empty(slice) != isl_bool_true)
+            {
+                isl_val *min_d1 = get_constant_bound(slice, 1, false);
+                if (isl_val_is_int(min_d1) != isl_bool_true)
+                {
+                    ERROR("The dependences of " + this->get_name() + " along " + L1.get_name() +
+                          " should have a bounded distance.", true);
+                }
+                lags.push_back(std::make_pair(k, (int) -isl_val_get_num_si(min_d1)));
+                DEBUG(3, tiramisu::str_dump("Distance " + std::to_string(k) + " along " + L0.get_name() +
+                                            ", lag " + std::to_string(lags.back().second)));
+                isl_val_free(min_d1);
+            }
+            isl_set_free(slice);
+        }
+    }
+    isl_set_free(carried);
+
+    this->tag_parallel_level(L0);
+    if (!lags.empty())
+    {
+        this->get_function()->add_wavefront_pipeline(this->get_name(), dimensions[0], lags);
+    }
+
+    DEBUG_INDENT(-4);
+}
+
 }
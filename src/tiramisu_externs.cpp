@@ -1,7 +1,14 @@
 #include "tiramisu/externs.h"
+#include <algorithm>
+#include <cstdlib>
 #ifdef WITH_MPI
 #include <mpi.h>
 #endif
+#ifdef __linux__
+#include <sched.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
 
 extern "C" {
 
@@ -45,9 +52,115 @@ double *tiramisu_address_of_float64(halide_buffer_t *buffer, unsigned long index
     return &(((double*)(buffer->host))[index]);
 }
 
+int tiramisu_madvise_huge_pages(void *ptr, uint64_t size) {
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    // madvise() needs a page aligned address: only advise the pages that
+    // are entirely inside the buffer.
+    uintptr_t page_size = (uintptr_t) sysconf(_SC_PAGESIZE);
+    uintptr_t start = ((uintptr_t) ptr + page_size - 1) & ~(page_size - 1);
+    uintptr_t end = ((uintptr_t) ptr + size) & ~(page_size - 1);
+    if (end > start) {
+        madvise((void *) start, end - start, MADV_HUGEPAGE);
+    }
+#endif
+    return 0;
+}
+
+// Atomic updates of buf[index].  Integer additions use a single atomic
+// instruction; the other updates use a compare-and-swap loop, which also
+// works for floating point values.
+#define TIRAMISU_ATOMIC_CAS_UPDATE(NAME, T, UPDATE)                                  \
+int tiramisu_atomic_##NAME(T *buf, int64_t index, T value) {                         \
+    T *addr = &buf[index];                                                           \
+    T old_value, new_value;                                                          \
+    __atomic_load(addr, &old_value, __ATOMIC_RELAXED);                               \
+    do {                                                                             \
+        new_value = (UPDATE);                                                        \
+    } while (!__atomic_compare_exchange(addr, &old_value, &new_value, true,          \
+                                        __ATOMIC_RELAXED, __ATOMIC_RELAXED));        \
+    return 0;                                                                        \
+}
+
+#define TIRAMISU_ATOMIC_UPDATES(SUFFIX, T)                                           \
+TIRAMISU_ATOMIC_CAS_UPDATE(mul_##SUFFIX, T, old_value * value)                       \
+TIRAMISU_ATOMIC_CAS_UPDATE(max_##SUFFIX, T, old_value < value ? value : old_value)   \
+TIRAMISU_ATOMIC_CAS_UPDATE(min_##SUFFIX, T, value < old_value ? value : old_value)
+
+#define TIRAMISU_ATOMIC_INT_UPDATES(SUFFIX, T)                                       \
+int tiramisu_atomic_add_##SUFFIX(T *buf, int64_t index, T value) {                   \
+    __atomic_fetch_add(&buf[index], value, __ATOMIC_RELAXED);                        \
+    return 0;                                                                        \
+}                                                                                    \
+TIRAMISU_ATOMIC_UPDATES(SUFFIX, T)
+
+TIRAMISU_ATOMIC_INT_UPDATES(int8, int8_t)
+TIRAMISU_ATOMIC_INT_UPDATES(int16, int16_t)
+TIRAMISU_ATOMIC_INT_UPDATES(int32, int32_t)
+TIRAMISU_ATOMIC_INT_UPDATES(int64, int64_t)
+TIRAMISU_ATOMIC_INT_UPDATES(uint8, uint8_t)
+TIRAMISU_ATOMIC_INT_UPDATES(uint16, uint16_t)
+TIRAMISU_ATOMIC_INT_UPDATES(uint32, uint32_t)
+TIRAMISU_ATOMIC_INT_UPDATES(uint64, uint64_t)
+
+TIRAMISU_ATOMIC_CAS_UPDATE(add_float32, float, old_value + value)
+TIRAMISU_ATOMIC_UPDATES(float32, float)
+TIRAMISU_ATOMIC_CAS_UPDATE(add_float64, double, old_value + value)
+TIRAMISU_ATOMIC_UPDATES(float64, double)
+
+int tiramisu_wavefront_wait(int32_t *flags, int32_t row, int32_t column) {
+    while (__atomic_load_n(&flags[row], __ATOMIC_ACQUIRE) < column) {
+#ifdef __linux__
+        sched_yield();
+#endif
+    }
+    return 0;
+}
+
+int tiramisu_wavefront_signal(int32_t *flags, int32_t row, int32_t column) {
+    __atomic_store_n(&flags[row], column, __ATOMIC_RELEASE);
+    return 0;
+}
+
+int tiramisu_parallel_num_threads() {
+    const char *env = getenv("HL_NUM_THREADS");
+    if (env != NULL && atoi(env) > 0) {
+        return atoi(env);
+    }
+#ifdef __linux__
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+    return (cores > 0) ? (int) cores : 1;
+#else
+    return 1;
+#endif
+}
+
+static int32_t tiramisu_guided_chunk_size(int32_t remaining, int32_t threads, int32_t min_chunk) {
+    int32_t size = (remaining + threads - 1) / std::max(threads, 1);
+    return std::min(std::max(size, min_chunk), remaining);
+}
+
+int tiramisu_guided_chunk_next(int32_t *cursor, int32_t extent, int32_t threads, int32_t min_chunk) {
+    int32_t begin = __atomic_load_n(cursor, __ATOMIC_RELAXED);
+    while (begin < extent &&
+           !__atomic_compare_exchange_n(cursor, &begin,
+                                        begin + tiramisu_guided_chunk_size(extent - begin, threads, min_chunk),
+                                        true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+    }
+    return begin;
+}
+
+int tiramisu_guided_chunk_count(int32_t extent, int32_t threads, int32_t min_chunk) {
+    int32_t count = 0;
+    for (int32_t begin = 0; begin < extent; count++) {
+        begin += tiramisu_guided_chunk_size(extent - begin, threads, min_chunk);
+    }
+    return count;
+}
+
 #ifdef WITH_MPI
 void *tiramisu_address_of_wait(halide_buffer_t *buffer, unsigned long index) {
-  return &(((MPI_Request*)(buffer->host))[index]);
+  // Each element of a request buffer holds a pointer to a pooled request.
+  return &(((MPI_Request**)(buffer->host))[index]);
 }
 #endif
 
@@ -2,12 +2,16 @@
 #include <isl/aff.h>
 #include <isl/set.h>
 #include <isl/map.h>
+#include <isl/point.h>
+#include <isl/val.h>
 #include <isl/id.h>
 #include <isl/constraint.h>
 #include <isl/union_map.h>
 #include <isl/union_set.h>
 #include <isl/ast_build.h>
 
+#include <algorithm>
+
 #include <tiramisu/debug.h>
 #include <tiramisu/core.h>
 
@@ -223,6 +227,105 @@ void function::Automatic_communication(tiramisu::computation* c1, tiramisu::comp
     }
 }
 
+void function::gen_data_distribution(int root)
+{
+    DEBUG_FCT_NAME(3);
+    DEBUG_INDENT(4);
+
+    // The computations of the function, the communications are not
+    // analyzed.
+    std::vector<tiramisu::computation *> distributed;
+    std::vector<tiramisu::computation *> inputs;
+    for (tiramisu::computation *c : this->get_computations())
+    {
+        if (c->is_send() || c->is_recv() || c->is_send_recv())
+            continue;
+        if (c->get_distributed_dimension() != -1)
+        {
+            if (c->get_expr().is_defined())
+                distributed.push_back(c);
+        }
+        else if (!c->get_expr().is_defined())
+            inputs.push_back(c);
+    }
+
+    // Exchange the data produced by the distributed computations.
+    for (tiramisu::computation *c : distributed)
+        c->gen_communication();
+
+    // Scatter the elements of the inputs that the ranks read.
+    std::vector<tiramisu::xfer> scatters;
+    for (tiramisu::computation *in : inputs)
+    {
+        isl_set *needed = nullptr;
+        for (tiramisu::computation *c : distributed)
+        {
+            isl_set *read = c->construct_needed_set(in->get_name());
+            if (read != nullptr)
+                needed = (needed == nullptr) ? read : isl_set_union(needed, read);
+        }
+        if (needed == nullptr)
+            continue;
+        if (isl_set_is_empty(needed))
+        {
+            isl_set_free(needed);
+            continue;
+        }
+        scatters.push_back(in->gen_root_communication_code(isl_set_coalesce(needed), tiramisu::rank_t::r_receiver, root));
+    }
+
+    // Gather the elements of the outputs.
+    std::vector<tiramisu::xfer> gathers;
+    for (tiramisu::computation *c : distributed)
+    {
+        if (c->get_access_relation() == NULL)
+            continue;
+        auto buff = this->get_buffers().find(isl_map_get_tuple_name(c->get_access_relation(), isl_dim_out));
+        if (buff == this->get_buffers().end() || buff->second->get_argument_type() != tiramisu::a_output)
+            continue;
+        gathers.push_back(c->gen_root_communication_code(c->construct_owned_set(tiramisu::rank_t::r_sender),
+                                                         tiramisu::rank_t::r_sender, root));
+    }
+
+    if (scatters.empty() && gathers.empty())
+    {
+        DEBUG_INDENT(-4);
+        return;
+    }
+
+    tiramisu::computation *first = nullptr;
+    tiramisu::computation *last = nullptr;
+    if (!this->sched_graph.empty())
+    {
+        first = this->get_first_cpt();
+        last = this->get_last_cpt();
+    }
+    else if (distributed.size() == 1)
+    {
+        first = distributed[0];
+        last = distributed[0];
+    }
+    if (first == nullptr || last == nullptr)
+        ERROR("gen_data_distribution() requires the computations of the function to be ordered in a sequence.", true);
+
+    // The scatters are done before the first computation and the gathers
+    // after the last one.
+    for (auto &x : scatters)
+    {
+        x.s->then(*x.r, computation::root);
+        x.r->then(*first, computation::root);
+        first = x.s;
+    }
+    for (auto &x : gathers)
+    {
+        last->then(*x.s, computation::root);
+        x.s->then(*x.r, computation::root);
+        last = x.r;
+    }
+
+    DEBUG_INDENT(-4);
+}
+
 // TODO: get_live_in_computations() does not consider the case of "maybe"
 // live-out (non-affine control flow, ...).
 std::vector<tiramisu::computation *> tiramisu::function::get_live_in_computations()
@@ -851,6 +954,39 @@ bool function::should_parallelize(const std::string &comp, int lev) const
     return found;
 }
 
+std::pair<tiramisu::parallel_schedule_t, int> function::get_parallel_schedule(const std::string &comp, int lev) const
+{
+    assert(!comp.empty());
+    assert(lev >= 0);
+
+    for (const auto &ps : this->parallel_schedules)
+    {
+        if ((std::get<0>(ps) == comp) && (std::get<1>(ps) == lev))
+        {
+            return std::make_pair(std::get<2>(ps), std::get<3>(ps));
+        }
+    }
+
+    return std::make_pair(tiramisu::s_default, 0);
+}
+
+std::tuple<tiramisu::distribution_t, int, std::vector<int>> function::get_distribution_policy(const std::string &comp,
+                                                                                             int lev) const
+{
+    assert(!comp.empty());
+    assert(lev >= 0);
+
+    for (const auto &dp : this->distribution_policies)
+    {
+        if ((std::get<0>(dp) == comp) && (std::get<1>(dp) == lev))
+        {
+            return std::make_tuple(std::get<2>(dp), std::get<3>(dp), std::get<4>(dp));
+        }
+    }
+
+    return std::make_tuple(tiramisu::d_rank, 0, std::vector<int>());
+}
+
 /**
 * Return the unrolling factor used to unroll the computation \p comp
 * at the loop level \p lev.
@@ -886,6 +1022,22 @@ int function::get_unrolling_factor(const std::string &comp, int lev) const
     return unrolling_factor;
 }
 
+tiramisu::vector_tail_t function::get_vector_tail(const std::string &comp, int lev) const
+{
+    assert(!comp.empty());
+    assert(lev >= 0);
+
+    for (const auto &vt : this->vector_tails)
+    {
+        if ((std::get<0>(vt) == comp) && (std::get<1>(vt) == lev))
+        {
+            return std::get<2>(vt);
+        }
+    }
+
+    return tiramisu::v_epilogue;
+}
+
 /**
 * Return the vector length of the computation \p comp at
 * at the loop level \p lev.
@@ -1278,6 +1430,305 @@ void tiramisu::function::allocate_and_map_buffers_automatically()
     DEBUG_INDENT(-4);
 }
 
+/**
+ * Compute the distance, in elements of each buffer dimension, between the
+ * buffer elements accessed by two consecutive iterations of the dynamic
+ * dimension \p dim of the time-space domain.
+ * \p access is a map from the time-space domain to the buffer.
+ * Return false if the distance is not a unique constant.
+ */
+bool get_access_distance_along_dimension(isl_map *access, int dim, std::vector<long> &distance)
+{
+    DEBUG_FCT_NAME(10);
+    DEBUG_INDENT(4);
+
+    // Build the map {T[t0, ..., t_dim, ...] -> T[t0, ..., t_dim + 1, ...]}.
+    isl_space *space = isl_space_domain(isl_map_get_space(access));
+    isl_map *next = isl_map_universe(isl_space_map_from_set(space));
+    for (int i = 0; i < isl_map_dim(next, isl_dim_in); i++)
+    {
+        isl_constraint *cst = isl_constraint_alloc_equality(
+                                  isl_local_space_from_space(isl_map_get_space(next)));
+        cst = isl_constraint_set_coefficient_si(cst, isl_dim_in, i, 1);
+        cst = isl_constraint_set_coefficient_si(cst, isl_dim_out, i, -1);
+        if (i == dim)
+            cst = isl_constraint_set_constant_si(cst, 1);
+        next = isl_map_add_constraint(next, cst);
+    }
+
+    // Buffer element -> buffer element accessed in the next iteration.
+    isl_map *successors = isl_map_apply_range(isl_map_reverse(isl_map_copy(access)), next);
+    successors = isl_map_apply_range(successors, isl_map_copy(access));
+    isl_set *deltas = isl_map_deltas(successors);
+
+    DEBUG(10, tiramisu::str_dump("Access distances: ", isl_set_to_str(deltas)));
+
+    bool unique = (isl_set_is_empty(deltas) == isl_bool_false) &&
+                  (isl_set_is_singleton(deltas) == isl_bool_true);
+
+    distance.clear();
+    if (unique)
+    {
+        isl_point *pt = isl_set_sample_point(isl_set_copy(deltas));
+        for (int i = 0; i < isl_set_dim(deltas, isl_dim_set); i++)
+        {
+            isl_val *v = isl_point_get_coordinate_val(pt, isl_dim_set, i);
+            distance.push_back(isl_val_get_num_si(v));
+            isl_val_free(v);
+        }
+        isl_point_free(pt);
+    }
+    isl_set_free(deltas);
+
+    DEBUG_INDENT(-4);
+
+    return unique;
+}
+
+std::map<std::string, std::vector<int>> tiramisu::function::pad_buffers(bool pad_arguments)
+{
+    DEBUG_FCT_NAME(3);
+    DEBUG_INDENT(4);
+
+    // Distances that are multiples of conflict_stride bytes map the
+    // accesses of consecutive iterations to a few cache sets (at most 4 of
+    // the 64 sets of a 32KB 8-way L1 cache) and alias on 4K boundaries.
+    const long conflict_stride = 1024;
+    const long cache_line = 64;
+
+    // Collect, for each buffer, the distances between the elements accessed
+    // by consecutive iterations of the innermost loop.
+    std::map<std::string, std::vector<std::vector<long>>> distances;
+
+    for (auto &comp : this->body)
+    {
+        if (!comp->should_schedule_this_computation() || comp->is_inline_computation() ||
+            !comp->has_accesses() || (comp->get_access_relation() == NULL))
+            continue;
+
+        int levels = comp->get_loop_levels_number();
+        if (levels == 0)
+            continue;
+
+        // The innermost dynamic dimension, in the trimmed schedule (i.e.
+        // without the duplication dimension).
+        int innermost = loop_level_into_dynamic_dimension(levels - 1) - 1;
+
+        std::vector<isl_map *> accesses;
+        accesses.push_back(isl_map_copy(comp->get_access_relation()));
+        generator::get_rhs_accesses(this, comp, accesses, true);
+
+        for (auto access : accesses)
+        {
+            access = isl_map_apply_domain(access, comp->get_trimmed_union_of_schedules());
+            std::string buffer_name = isl_map_get_tuple_name(access, isl_dim_out);
+
+            std::vector<long> distance;
+            if (get_access_distance_along_dimension(access, innermost, distance))
+            {
+                DEBUG(3, tiramisu::str_dump("Access to " + buffer_name + " from " + comp->get_name() +
+                                            " has a constant distance along the innermost loop."));
+                distances[buffer_name].push_back(distance);
+            }
+            isl_map_free(access);
+        }
+    }
+
+    std::map<std::string, std::vector<int>> padding;
+
+    for (const auto &d : distances)
+    {
+        const auto &buffer_entry = this->get_buffers().find(d.first);
+        if (buffer_entry == this->get_buffers().end())
+            continue;
+
+        tiramisu::buffer *buf = buffer_entry->second;
+
+        if ((buf->get_argument_type() != tiramisu::a_temporary) && !pad_arguments)
+        {
+            DEBUG(3, tiramisu::str_dump("Buffer " + buf->get_name() + " is an argument. Not padded."));
+            continue;
+        }
+
+        if (!buf->has_constant_extents() || (buf->get_location() != cuda_ast::memory_location::host))
+        {
+            DEBUG(3, tiramisu::str_dump("Buffer " + buf->get_name() + " cannot be padded."));
+            continue;
+        }
+
+        int n_dims = buf->get_n_dims();
+        long elem_size = halide_type_from_tiramisu_type(buf->get_elements_type()).bytes();
+        int line_elems = std::max(1L, cache_line / elem_size);
+
+        std::vector<long> sizes;
+        for (const auto &sz : buf->get_dim_sizes())
+            sizes.push_back(sz.get_int_val());
+        std::vector<int> pad(n_dims, 0);
+
+        for (const auto &distance : d.second)
+        {
+            if (distance.size() != (size_t) n_dims)
+                continue;
+
+            // Padding a dimension changes the stride of the dimensions
+            // that surround it only.
+            int outermost = 0;
+            while ((outermost < n_dims) && (distance[outermost] == 0))
+                outermost++;
+
+            for (int k = n_dims - 1; k > outermost; k--)
+            {
+                long stride = 0, pitch = elem_size;
+                for (int i = n_dims - 1; i >= 0; i--)
+                {
+                    stride += distance[i] * pitch;
+                    pitch *= sizes[i];
+                }
+                stride = std::abs(stride);
+
+                if ((stride == 0) || (stride % conflict_stride != 0))
+                    break;
+
+                if (pad[k] == 0)
+                {
+                    pad[k] = line_elems;
+                    sizes[k] += line_elems;
+                }
+            }
+        }
+
+        if (std::all_of(pad.begin(), pad.end(), [](int p) { return p == 0; }))
+            continue;
+
+        std::string report = "Padding buffer " + buf->get_name() + ": ";
+        for (int i = 0; i < n_dims; i++)
+        {
+            report += "[" + std::to_string(buf->get_dim_sizes()[i].get_int_val());
+            if (pad[i] != 0)
+            {
+                report += " + " + std::to_string(pad[i]);
+                buf->set_dim_size(i, sizes[i]);
+            }
+            report += "]";
+        }
+        tiramisu::str_dump(report + "\n");
+
+        padding[buf->get_name()] = pad;
+    }
+
+    DEBUG_INDENT(-4);
+
+    return padding;
+}
+
+void tiramisu::function::pad_buffers_for_vector_tails()
+{
+    DEBUG_FCT_NAME(3);
+    DEBUG_INDENT(4);
+
+    // The number of elements to add to each dimension of each buffer.  A
+    // buffer accessed by several loops is padded for the largest overrun.
+    std::map<std::string, std::vector<long>> padding;
+
+    for (const auto &vt : this->vector_tails)
+    {
+        if (std::get<2>(vt) != tiramisu::v_padded)
+            continue;
+
+        const std::string &name = std::get<0>(vt);
+        int level = std::get<1>(vt);
+        int v = this->get_vector_length(name, level);
+
+        for (auto *comp : this->get_computation_by_name(name))
+        {
+            if (!comp->should_schedule_this_computation() || comp->is_inline_computation() ||
+                !comp->has_accesses() || (comp->get_access_relation() == NULL))
+                continue;
+
+            // The vectorized dynamic dimension, in the trimmed schedule.
+            int vec_dim = loop_level_into_dynamic_dimension(level) - 1;
+
+            std::vector<isl_map *> accesses;
+            accesses.push_back(isl_map_copy(comp->get_access_relation()));
+            generator::get_rhs_accesses(this, comp, accesses, true);
+
+            for (auto access : accesses)
+            {
+                access = isl_map_apply_domain(access, comp->get_trimmed_union_of_schedules());
+                std::string buffer_name = isl_map_get_tuple_name(access, isl_dim_out);
+
+                std::vector<long> distance;
+                bool constant = get_access_distance_along_dimension(access, vec_dim, distance);
+                isl_map_free(access);
+
+                const auto &buffer_entry = this->get_buffers().find(buffer_name);
+                if (buffer_entry == this->get_buffers().end())
+                    continue;
+
+                tiramisu::buffer *buf = buffer_entry->second;
+
+                if (!constant || (distance.size() != (size_t) buf->get_n_dims()) ||
+                    std::any_of(distance.begin(), distance.end(), [](long d) { return d < 0; }))
+                {
+                    ERROR("The accesses of " + name + " to the buffer " + buffer_name +
+                          " do not advance by a constant non-negative distance along the vectorized loop;"
+                          " the buffer cannot be padded for a v_padded tail (use v_masked).", true);
+                }
+
+                if ((buf->get_argument_type() != tiramisu::a_temporary) && !this->pad_argument_buffers)
+                {
+                    ERROR("Computation " + name + " is vectorized with a v_padded tail but the buffer " +
+                          buffer_name + " is an argument of the function. Enable the padding of arguments"
+                          " (set_automatic_buffer_padding(true, true)) and allocate the padded sizes, or use v_masked.", true);
+                }
+
+                if (!buf->has_constant_extents() || (buf->get_location() != cuda_ast::memory_location::host))
+                {
+                    ERROR("Computation " + name + " is vectorized with a v_padded tail but the buffer " +
+                          buffer_name + " cannot be padded (use v_masked).", true);
+                }
+
+                std::vector<long> &pad = padding[buffer_name];
+                pad.resize(buf->get_n_dims(), 0);
+                for (int i = 0; i < buf->get_n_dims(); i++)
+                    pad[i] = std::max(pad[i], (v - 1) * distance[i]);
+            }
+        }
+    }
+
+    for (const auto &p : padding)
+    {
+        tiramisu::buffer *buf = this->get_buffers().find(p.first)->second;
+
+        std::string report = "Padding buffer " + buf->get_name() + " for a v_padded vector tail: ";
+        for (int i = 0; i < buf->get_n_dims(); i++)
+        {
+            int size = buf->get_dim_sizes()[i].get_int_val();
+            report += "[" + std::to_string(size);
+            if (p.second[i] != 0)
+            {
+                report += " + " + std::to_string(p.second[i]);
+                buf->set_dim_size(i, size + p.second[i]);
+            }
+            report += "]";
+        }
+        tiramisu::str_dump(report + "\n");
+    }
+
+    DEBUG_INDENT(-4);
+}
+
+void tiramisu::function::set_automatic_buffer_padding(bool pad, bool pad_arguments)
+{
+    this->automatic_buffer_padding = pad;
+    this->pad_argument_buffers = pad_arguments;
+}
+
+void tiramisu::function::set_persistent_communication(bool enable)
+{
+    this->persistent_communication = enable;
+}
+
 std::string tiramisu::function::get_gpu_thread_iterator(const std::string &comp, int lev0) const
 {
     assert(!comp.empty());
@@ -1394,6 +1845,170 @@ bool tiramisu::function::should_unroll(const std::string &comp, int lev0) const
     return found;
 }
 
+bool tiramisu::function::should_prefetch(const std::string &comp, int lev0) const
+{
+    assert(!comp.empty());
+    assert(lev0 >= 0);
+
+    DEBUG_FCT_NAME(10);
+    DEBUG_INDENT(4);
+
+    bool found = false;
+    for (const auto &pd : this->prefetch_dimensions)
+    {
+        if ((std::get<0>(pd) == comp) && (std::get<1>(pd) == lev0))
+        {
+            found = true;
+        }
+    }
+
+    std::string str = "Dimension " + std::to_string(lev0) +
+                      (found ? " has" : " does not have") +
+                      " prefetches.";
+    DEBUG(10, tiramisu::str_dump(str));
+
+    DEBUG_INDENT(-4);
+    return found;
+}
+
+std::vector<std::pair<std::string, int>> tiramisu::function::get_prefetches(const std::string &comp, int lev) const
+{
+    assert(!comp.empty());
+    assert(lev >= 0);
+
+    std::vector<std::pair<std::string, int>> prefetches;
+
+    for (const auto &pd : this->prefetch_dimensions)
+    {
+        if ((std::get<0>(pd) == comp) && (std::get<1>(pd) == lev))
+        {
+            prefetches.push_back(std::make_pair(std::get<2>(pd), std::get<3>(pd)));
+        }
+    }
+
+    return prefetches;
+}
+
+std::vector<std::string> tiramisu::function::get_nontemporal_buffers() const
+{
+    std::vector<std::string> buffers;
+
+    for (const auto &name : this->nontemporal_stores)
+    {
+        for (auto *comp : this->get_computation_by_name(name))
+        {
+            tiramisu::buffer *buff = comp->get_buffer();
+            if (buff == nullptr)
+            {
+                ERROR("Computation " + name + " is not stored in a buffer, its stores cannot be non-temporal.", true);
+            }
+            if (std::find(buffers.begin(), buffers.end(), buff->get_name()) == buffers.end())
+            {
+                buffers.push_back(buff->get_name());
+            }
+        }
+    }
+
+    return buffers;
+}
+
+bool tiramisu::function::should_pipeline_wavefront(const std::string &comp, int lev) const
+{
+    assert(!comp.empty());
+    assert(lev >= 0);
+
+    for (const auto &wp : this->wavefront_pipelines)
+    {
+        if ((std::get<0>(wp) == comp) && (std::get<1>(wp) == lev))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+std::vector<std::pair<int, int>> tiramisu::function::get_wavefront_lags(const std::string &comp, int lev) const
+{
+    assert(!comp.empty());
+    assert(lev >= 0);
+
+    for (const auto &wp : this->wavefront_pipelines)
+    {
+        if ((std::get<0>(wp) == comp) && (std::get<1>(wp) == lev))
+        {
+            return std::get<2>(wp);
+        }
+    }
+
+    return {};
+}
+
+int tiramisu::function::get_unroll_and_jam_factor(const std::string &comp, int lev) const
+{
+    assert(!comp.empty());
+    assert(lev >= 0);
+
+    for (const auto &uj : this->unroll_and_jam_dimensions)
+    {
+        if ((std::get<0>(uj) == comp) && (std::get<1>(uj) == lev))
+        {
+            return std::get<2>(uj);
+        }
+    }
+
+    return 0;
+}
+
+bool tiramisu::function::should_promote_to_register(const std::string &comp, int lev) const
+{
+    assert(!comp.empty());
+    assert(lev >= 0);
+
+    return std::find(this->register_promotions.begin(), this->register_promotions.end(),
+                     std::make_pair(comp, lev)) != this->register_promotions.end();
+}
+
+int tiramisu::function::get_collapse_depth(const std::string &comp, int lev) const
+{
+    assert(!comp.empty());
+    assert(lev >= 0);
+
+    for (const auto &cl : this->collapsed_loops)
+    {
+        if ((std::get<0>(cl) == comp) && (std::get<1>(cl) == lev))
+        {
+            return std::get<2>(cl);
+        }
+    }
+
+    return 0;
+}
+
+bool tiramisu::function::should_store_nontemporally(const std::string &comp) const
+{
+    assert(!comp.empty());
+
+    return std::find(this->nontemporal_stores.begin(), this->nontemporal_stores.end(), comp) !=
+           this->nontemporal_stores.end();
+}
+
+bool tiramisu::function::should_update_atomically(const std::string &comp) const
+{
+    assert(!comp.empty());
+
+    return std::find(this->atomic_updates.begin(), this->atomic_updates.end(), comp) !=
+           this->atomic_updates.end();
+}
+
+bool tiramisu::function::should_run_as_task(const std::string &comp) const
+{
+    assert(!comp.empty());
+
+    return std::find(this->task_parallel_computations.begin(), this->task_parallel_computations.end(), comp) !=
+           this->task_parallel_computations.end();
+}
+
 bool tiramisu::function::should_map_to_gpu_block(const std::string &comp, int lev0) const
 {
     DEBUG_FCT_NAME(10);
@@ -1712,6 +2327,14 @@ void tiramisu::function::add_vector_dimension(std::string stmt_name, int vec_dim
     this->vector_dimensions.push_back(std::make_tuple(stmt_name, vec_dim, vector_length));
 }
 
+void tiramisu::function::add_vector_tail(std::string stmt_name, int vec_dim, tiramisu::vector_tail_t tail)
+{
+    assert(vec_dim >= 0);
+    assert(!stmt_name.empty());
+
+    this->vector_tails.push_back(std::make_tuple(stmt_name, vec_dim, tail));
+}
+
 void tiramisu::function::add_distributed_dimension(std::string stmt_name, int dim)
 {
     assert(dim >= 0);
@@ -1720,6 +2343,17 @@ void tiramisu::function::add_distributed_dimension(std::string stmt_name, int di
     this->distributed_dimensions.push_back({stmt_name, dim});
 }
 
+void tiramisu::function::add_distribution_policy(std::string stmt_name, int dim, tiramisu::distribution_t policy,
+                                                 int block_size, std::vector<int> weights)
+{
+    assert(dim >= 0);
+    assert(!stmt_name.empty());
+    assert(block_size >= 0);
+    assert(!weights.empty());
+
+    this->distribution_policies.push_back(std::make_tuple(stmt_name, dim, policy, block_size, weights));
+}
+
 void tiramisu::function::add_parallel_dimension(std::string stmt_name, int vec_dim)
 {
     assert(vec_dim >= 0);
@@ -1728,6 +2362,16 @@ void tiramisu::function::add_parallel_dimension(std::string stmt_name, int vec_d
     this->parallel_dimensions.push_back({stmt_name, vec_dim});
 }
 
+void tiramisu::function::add_parallel_schedule(std::string stmt_name, int dim,
+                                               tiramisu::parallel_schedule_t policy, int chunk_size)
+{
+    assert(dim >= 0);
+    assert(!stmt_name.empty());
+    assert(chunk_size >= 0);
+
+    this->parallel_schedules.push_back(std::make_tuple(stmt_name, dim, policy, chunk_size));
+}
+
 void tiramisu::function::add_unroll_dimension(std::string stmt_name, int level, int factor)
 {
     assert(level >= 0);
@@ -1737,6 +2381,72 @@ void tiramisu::function::add_unroll_dimension(std::string stmt_name, int level,
     this->unroll_dimensions.push_back(std::make_tuple(stmt_name, level, factor));
 }
 
+void tiramisu::function::add_prefetch_dimension(std::string stmt_name, int level, std::string buffer_name,
+                                                int distance)
+{
+    assert(level >= 0);
+    assert(!stmt_name.empty());
+    assert(!buffer_name.empty());
+    assert(distance >= 0);
+
+    this->prefetch_dimensions.push_back(std::make_tuple(stmt_name, level, buffer_name, distance));
+}
+
+void tiramisu::function::add_nontemporal_store(std::string stmt_name)
+{
+    assert(!stmt_name.empty());
+
+    this->nontemporal_stores.push_back(stmt_name);
+}
+
+void tiramisu::function::add_atomic_update(std::string stmt_name)
+{
+    assert(!stmt_name.empty());
+
+    this->atomic_updates.push_back(stmt_name);
+}
+
+void tiramisu::function::add_task_parallel_computation(std::string stmt_name)
+{
+    assert(!stmt_name.empty());
+
+    this->task_parallel_computations.push_back(stmt_name);
+}
+
+void tiramisu::function::add_wavefront_pipeline(std::string stmt_name, int L, std::vector<std::pair<int, int>> lags)
+{
+    assert(!stmt_name.empty());
+    assert(L >= 0);
+
+    this->wavefront_pipelines.push_back(std::make_tuple(stmt_name, L, lags));
+}
+
+void tiramisu::function::add_unroll_and_jam_dimension(std::string stmt_name, int L, int factor)
+{
+    assert(!stmt_name.empty());
+    assert(L >= 0);
+    assert(factor > 1);
+
+    this->unroll_and_jam_dimensions.push_back(std::make_tuple(stmt_name, L, factor));
+}
+
+void tiramisu::function::add_register_promotion(std::string stmt_name, int L)
+{
+    assert(!stmt_name.empty());
+    assert(L >= 0);
+
+    this->register_promotions.push_back(std::make_pair(stmt_name, L));
+}
+
+void tiramisu::function::add_collapsed_loops(std::string stmt_name, int L, int n)
+{
+    assert(!stmt_name.empty());
+    assert(L >= 0);
+    assert(n >= 2);
+
+    this->collapsed_loops.push_back(std::make_tuple(stmt_name, L, n));
+}
+
 void tiramisu::function::add_gpu_block_dimensions(std::string stmt_name, int dim0,
         int dim1, int dim2)
 {
@@ -1918,7 +2628,8 @@ isl_union_map *tiramisu::function::get_trimmed_schedule() const
 
 void tiramisu::function::lift_dist_comps() {
     for (std::vector<tiramisu::computation *>::iterator comp = body.begin(); comp != body.end(); comp++) {
-        if ((*comp)->is_send() || (*comp)->is_recv() || (*comp)->is_wait() || (*comp)->is_send_recv()) {
+        if ((*comp)->is_send() || (*comp)->is_recv() || (*comp)->is_wait() || (*comp)->is_send_recv() ||
+            (*comp)->is_collective()) {
             xfer_prop chan = static_cast<tiramisu::communicator *>(*comp)->get_xfer_props();
             if (chan.contains_attr(MPI)) {
                 lift_mpi_comp(*comp);
@@ -1930,6 +2641,40 @@ void tiramisu::function::lift_dist_comps() {
 }
 
 void tiramisu::function::lift_mpi_comp(tiramisu::computation *comp) {
+    // Turn the call of a blocking send or receive (count, peer, tag, data)
+    // into a call of its strided version (blocks, block length, stride,
+    // peer, tag, data).
+    auto make_strided_mpi_call = [](tiramisu::communicator *c) {
+        assert(c->library_call_args.size() == 4);
+        std::vector<tiramisu::expr> args;
+        args.push_back(tiramisu::expr(tiramisu::o_cast, p_int32, c->get_block_count()));
+        args.push_back(c->library_call_args[0]);
+        args.push_back(tiramisu::expr(tiramisu::o_cast, p_int32, c->get_block_stride()));
+        args.insert(args.end(), c->library_call_args.begin() + 1, c->library_call_args.end());
+        c->library_call_args = args;
+        if (c->rhs_argument_idx == 3) {
+            c->rhs_argument_idx = 5;
+        }
+        if (c->lhs_argument_idx == 3) {
+            c->lhs_argument_idx = 5;
+        }
+        // tiramisu_MPI_Send_int32 -> tiramisu_MPI_Send_vector_int32
+        c->library_call_name.insert(c->library_call_name.rfind('_'), "_vector");
+    };
+
+    // Turn the call of a blocking send or receive into the call of its
+    // posted version, which takes the same arguments.
+    auto make_posted_mpi_call = [](tiramisu::communicator *c) {
+        assert(!c->is_strided() && "Strided transfers cannot be posted.");
+        // tiramisu_MPI_Send_int32 -> tiramisu_MPI_Isend_posted_int32
+        std::string prefix = "tiramisu_MPI_";
+        std::string type_suffix = c->library_call_name.substr(c->library_call_name.rfind('_'));
+        std::string op = c->library_call_name.substr(prefix.size(), c->library_call_name.size() - prefix.size() -
+                                                                    type_suffix.size());
+        std::string posted_op = (op == "Send") ? "Isend" : ((op == "Ssend") ? "Issend" : "Irecv");
+        c->library_call_name = prefix + posted_op + "_posted" + type_suffix;
+    };
+
     if (comp->is_send()) {
         send *s = static_cast<send *>(comp);
         tiramisu::expr num_elements(s->get_num_elements());
@@ -1945,6 +2690,12 @@ void tiramisu::function::lift_mpi_comp(tiramisu::computation *comp) {
             // This additional RHS argument is to the request buffer. It is really more of a side effect.
             s->wait_argument_idx = 4;
         }
+        if (s->is_strided()) {
+            make_strided_mpi_call(s);
+        }
+        if (s->is_posted()) {
+            make_posted_mpi_call(s);
+        }
     } else if (comp->is_recv()) {
         recv *r = static_cast<recv *>(comp);
         send *s = r->get_matching_send();
@@ -1963,6 +2714,35 @@ void tiramisu::function::lift_mpi_comp(tiramisu::computation *comp) {
             // This RHS argument is to the request buffer. It is really more of a side effect.
           r->wait_argument_idx = 4;
         }
+        if (r->is_strided()) {
+            make_strided_mpi_call(r);
+        }
+        if (r->is_posted()) {
+            make_posted_mpi_call(r);
+        }
+    } else if (comp->is_collective()) {
+        collective *c = static_cast<collective *>(comp);
+        // (count, [root,] contribution, result)
+        c->library_call_args.clear();
+        c->library_call_args.push_back(tiramisu::expr(tiramisu::o_cast, p_int32, c->get_num_elements()));
+        if (c->get_collective_type() == BROADCAST) {
+            c->library_call_args.push_back(tiramisu::expr(tiramisu::o_cast, p_int32, c->get_root()));
+        }
+        c->rhs_argument_idx = c->library_call_args.size();
+        c->lhs_argument_idx = c->rhs_argument_idx + 1;
+        c->library_call_args.resize(c->lhs_argument_idx + 1);
+        c->lhs_access_type = tiramisu::o_address_of;
+    } else if (comp->is_send_recv()) {
+        send_recv *sr = static_cast<send_recv *>(comp);
+        assert((sr->get_xfer_props().contains_attr(RMA_PUT) || sr->get_xfer_props().contains_attr(RMA_GET)) &&
+               "An MPI transfer in a single computation must be one-sided (RMA_PUT or RMA_GET).");
+        // (count, peer, data, store_in)
+        sr->rhs_argument_idx = 2;
+        sr->lhs_argument_idx = 3;
+        sr->library_call_args.resize(4);
+        sr->library_call_args[0] = tiramisu::expr(tiramisu::o_cast, p_int32, sr->get_num_elements());
+        sr->library_call_args[1] = tiramisu::expr(tiramisu::o_cast, p_int32, sr->get_peer());
+        sr->lhs_access_type = tiramisu::o_address_of;
     } else if (comp->is_wait()) {
         wait *w = static_cast<wait *>(comp);
         // Determine the appropriate number of function args and set ones that we can already know
@@ -1972,6 +2752,43 @@ void tiramisu::function::lift_mpi_comp(tiramisu::computation *comp) {
     }
 }
 
+int tiramisu::function::get_nonblocking_request_count() const
+{
+    std::set<std::string> request_buffers;
+    int count = 0;
+
+    for (const auto &comp : this->body)
+    {
+        if ((comp->is_send() || comp->is_recv()) && comp->wait_access_map != nullptr &&
+            static_cast<tiramisu::communicator *>(comp)->get_xfer_props().contains_attr(NONBLOCK))
+        {
+            std::string name = isl_map_get_tuple_name(comp->wait_access_map, isl_dim_out);
+            if (!request_buffers.insert(name).second)
+            {
+                continue;
+            }
+
+            const auto &buffer_entry = this->get_buffers().find(name);
+            assert(buffer_entry != this->get_buffers().end());
+            const tiramisu::buffer *requests = buffer_entry->second;
+
+            // The pool grows at run time if a parametric request buffer
+            // needs more requests.
+            int size = 1;
+            if (requests->has_constant_extents())
+            {
+                for (const auto &dim : requests->get_dim_sizes())
+                {
+                    size *= dim.get_int_val();
+                }
+            }
+            count += size;
+        }
+    }
+
+    return count;
+}
+
 void function::gen_ordering_schedules()
 {
     DEBUG_FCT_NAME(3);
@@ -2070,6 +2887,9 @@ void tiramisu::function::codegen(const std::vector<tiramisu::buffer *> &argument
             DEBUG(3, tiramisu::str_dump("You must specify the corresponding CPU buffer to each GPU buffer else you should do the communication manually"));
     }
     this->set_arguments(arguments);
+    if (this->automatic_buffer_padding)
+        this->pad_buffers(this->pad_argument_buffers);
+    this->pad_buffers_for_vector_tails();
     this->lift_dist_comps();
     this->gen_time_space_domain();
     this->gen_isl_ast();
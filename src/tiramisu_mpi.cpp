@@ -1,10 +1,345 @@
+#include <algorithm>
 #include <cstdlib>
 #include <cstdio>
 #include <cassert>
+#include <cstring>
+#include <list>
+#include <string>
+#include <vector>
 #include "tiramisu/mpi_comm.h"
 
 #ifdef WITH_MPI
 
+namespace
+{
+
+// Pool of MPI requests used by the nonblocking operations.  Requests are
+// allocated in blocks that are only freed by tiramisu_MPI_cleanup(), so a
+// request keeps its address while it is in flight.  MPI is initialized with
+// MPI_THREAD_FUNNELED, so the pool is only accessed by one thread.
+std::vector<MPI_Request *> request_blocks;
+std::vector<MPI_Request *> free_requests;
+int pool_size = 0;
+
+// Scratch space for the requests passed to MPI_Waitall, MPI_Testsome and
+// MPI_Startall.
+std::vector<MPI_Request> batch_requests;
+std::vector<MPI_Request *> batch_slots;
+std::vector<int> batch_indices;
+
+// Persistent requests.  They are created in groups of consecutive entries
+// around the loops that repeat the same transfers, and groups are freed in
+// the reverse order of their creation (loops are nested).
+std::vector<MPI_Request> persistent_requests;
+
+// Strided transfers whose contiguous blocks are smaller than this (in bytes)
+// are packed into a contiguous buffer, since MPI implementations handle
+// vector datatypes with tiny blocks poorly.  Larger blocks are sent
+// directly from the buffer using a vector datatype.
+const int strided_pack_threshold = 64;
+
+struct vector_datatype_t
+{
+    int blocks;
+    int block_length;
+    int stride;
+    MPI_Datatype base;
+    MPI_Datatype type;
+};
+
+// Vector datatypes are committed once and reused by the following transfers
+// of the same region shape.
+std::vector<vector_datatype_t> vector_datatypes;
+
+std::vector<char> packed_data;
+
+// Requests of the posted transfers, which are all completed by
+// tiramisu_MPI_Wait_posted().  The communications generated by
+// gen_communication() are posted to be overlapped with the computation.
+std::vector<MPI_Request> posted_requests;
+
+// Aggregated messages.  The elements sent to a peer with a tag during a
+// communication phase are appended to one message, which is sent when the
+// phase is flushed.  The messages are sent with MPI_Isend (the peers may
+// be sending to each other) and stay alive until they complete.  Received
+// messages are read by the receives of their elements in the order in
+// which they were sent.
+struct aggregated_message_t
+{
+    int peer;
+    int tag;
+    std::vector<char> data;
+    size_t position;
+    MPI_Request request;
+};
+
+std::vector<aggregated_message_t> outgoing_messages;
+std::list<aggregated_message_t> sent_messages;
+std::vector<aggregated_message_t> incoming_messages;
+
+// Windows of the buffers accessed by the one-sided transfers.  A window
+// covers a whole buffer.  Buffers have the same layout on every rank, so an
+// element is at the same displacement from the base of the window on every
+// rank.
+struct window_t
+{
+    std::string name;
+    char *base;
+    size_t size;
+    MPI_Win win;
+    // If the buffer is node-shared: the shared window of the buffer, and
+    // the base of the buffer of each rank of the node.
+    MPI_Win shared_win;
+    std::vector<char *> peer_bases;
+};
+
+std::vector<window_t> windows;
+
+// Memory shared by the ranks of a node, allocated by
+// tiramisu_MPI_alloc_node_shared().  The segments of all the ranks of a node
+// are mapped in the address space of each of them, so the one-sided
+// transfers between the ranks of a node are copies.  The shared windows are
+// kept in a passive epoch (lock_all), as required by MPI_Win_sync.
+struct node_segment_t
+{
+    char *base;
+    size_t size;
+    MPI_Win win;
+    std::vector<char *> peer_bases;
+};
+
+std::vector<node_segment_t> node_segments;
+
+MPI_Comm node_comm = MPI_COMM_NULL;
+
+// The rank in node_comm of each rank of MPI_COMM_WORLD, MPI_UNDEFINED for
+// the ranks of the other nodes.
+std::vector<int> node_ranks;
+
+void init_node_comm()
+{
+    if (node_comm != MPI_COMM_NULL) {
+        return;
+    }
+    MPI_Comm_split_type(MPI_COMM_WORLD, MPI_COMM_TYPE_SHARED, 0, MPI_INFO_NULL, &node_comm);
+    int world_size;
+    MPI_Comm_size(MPI_COMM_WORLD, &world_size);
+    std::vector<int> world_ranks(world_size);
+    for (int i = 0; i < world_size; i++) {
+        world_ranks[i] = i;
+    }
+    MPI_Group world_group, node_group;
+    MPI_Comm_group(MPI_COMM_WORLD, &world_group);
+    MPI_Comm_group(node_comm, &node_group);
+    node_ranks.resize(world_size);
+    MPI_Group_translate_ranks(world_group, world_size, world_ranks.data(), node_group, node_ranks.data());
+    MPI_Group_free(&world_group);
+    MPI_Group_free(&node_group);
+}
+
+// Return the address of \p address (in the window \p w) on the rank \p peer
+// if \p peer is on the same node and the buffer is node-shared, NULL
+// otherwise.
+char *get_node_shared_address(const window_t &w, const void *address, int peer)
+{
+    if (w.peer_bases.empty() || node_ranks[peer] == MPI_UNDEFINED) {
+        return NULL;
+    }
+    return w.peer_bases[node_ranks[peer]] + ((const char *) address - w.base);
+}
+
+window_t &find_window(const void *address)
+{
+    for (window_t &w : windows) {
+        if ((const char *) address >= w.base && (const char *) address < w.base + w.size) {
+            return w;
+        }
+    }
+    assert(false && "One-sided transfer on a buffer that is not exposed.");
+    return windows.front();
+}
+
+MPI_Datatype get_vector_datatype(int blocks, int block_length, int stride, MPI_Datatype base)
+{
+    for (const vector_datatype_t &t : vector_datatypes) {
+        if (t.blocks == blocks && t.block_length == block_length && t.stride == stride && t.base == base) {
+            return t.type;
+        }
+    }
+    vector_datatype_t t = {blocks, block_length, stride, base, MPI_DATATYPE_NULL};
+    MPI_Type_vector(blocks, block_length, stride, base, &t.type);
+    MPI_Type_commit(&t.type);
+    vector_datatypes.push_back(t);
+    return t.type;
+}
+
+void *get_packed_data(size_t size)
+{
+    if (packed_data.size() < size) {
+        packed_data.resize(size);
+    }
+    return packed_data.data();
+}
+
+// The number of elements of the reduction that each rank gets in a reduce
+// scatter of \p count elements.  MPI_Reduce_scatter_block() splits the
+// result in equal blocks, so \p count must be a multiple of the number of
+// ranks (the elements left over would be silently dropped).
+int reduce_scatter_block_size(int count)
+{
+    int size;
+    check_MPI_error(MPI_Comm_size(MPI_COMM_WORLD, &size));
+    if (count % size != 0) {
+        fprintf(stderr, "Reduce scatter of %d elements over %d ranks: the number of elements must be a "
+                        "multiple of the number of ranks.\n", count, size);
+        exit(28);
+    }
+    return count / size;
+}
+
+// The copies of the blocks are contiguous and get vectorized by the
+// compiler.
+template <typename T>
+void pack_blocks(T *__restrict__ packed, const T *__restrict__ data, int blocks, int block_length, int stride)
+{
+    for (int b = 0; b < blocks; b++) {
+        const T *block = data + (long) b * stride;
+        T *packed_block = packed + (long) b * block_length;
+        for (int i = 0; i < block_length; i++) {
+            packed_block[i] = block[i];
+        }
+    }
+}
+
+template <typename T>
+void unpack_blocks(T *__restrict__ data, const T *__restrict__ packed, int blocks, int block_length, int stride)
+{
+    for (int b = 0; b < blocks; b++) {
+        T *block = data + (long) b * stride;
+        const T *packed_block = packed + (long) b * block_length;
+        for (int i = 0; i < block_length; i++) {
+            block[i] = packed_block[i];
+        }
+    }
+}
+
+void grow_request_pool(int count)
+{
+    MPI_Request *block = (MPI_Request *) malloc(count * sizeof(MPI_Request));
+    assert(block != NULL && "Cannot allocate MPI requests.");
+    request_blocks.push_back(block);
+    pool_size += count;
+    for (int i = count - 1; i >= 0; i--) {
+        free_requests.push_back(&block[i]);
+    }
+}
+
+MPI_Request *acquire_request()
+{
+    if (free_requests.empty()) {
+        // Double the pool when the requests reserved at codegen time are
+        // not enough.
+        grow_request_pool(pool_size > 0 ? pool_size : 16);
+    }
+    MPI_Request *request = free_requests.back();
+    free_requests.pop_back();
+    return request;
+}
+
+void release_request(MPI_Request *request)
+{
+    free_requests.push_back(request);
+}
+
+// Collect the pending requests of the request slots [slots, slots + count).
+// Empty slots (NULL) are skipped.
+void gather_requests(int count, void **slots)
+{
+    batch_requests.clear();
+    batch_slots.clear();
+    for (int i = 0; i < count; i++) {
+        if (slots[i] != NULL) {
+            batch_requests.push_back(*((MPI_Request *) slots[i]));
+            batch_slots.push_back((MPI_Request *) slots[i]);
+        }
+    }
+}
+
+
+// Aggregated messages are sent as bytes: the transfers of a tag may have
+// different element types, and the messages to a peer are only ordered by
+// tag.
+int find_message(std::vector<aggregated_message_t> &messages, int peer, int tag)
+{
+    for (size_t i = 0; i < messages.size(); i++) {
+        if (messages[i].peer == peer && messages[i].tag == tag) {
+            return i;
+        }
+    }
+    aggregated_message_t message;
+    message.peer = peer;
+    message.tag = tag;
+    message.position = 0;
+    message.request = MPI_REQUEST_NULL;
+    messages.push_back(message);
+    return messages.size() - 1;
+}
+
+void append_aggregated(int dest, int tag, const void *data, size_t size)
+{
+    aggregated_message_t &message = outgoing_messages[find_message(outgoing_messages, dest, tag)];
+    message.data.insert(message.data.end(), (const char *) data, (const char *) data + size);
+}
+
+void read_aggregated(int source, int tag, void *store_in, size_t size)
+{
+    char *destination = (char *) store_in;
+    while (size > 0) {
+        int index = find_message(incoming_messages, source, tag);
+        aggregated_message_t &message = incoming_messages[index];
+        if (message.position == message.data.size()) {
+            MPI_Status status;
+            check_MPI_error(MPI_Probe(source, tag, MPI_COMM_WORLD, &status));
+            int count;
+            check_MPI_error(MPI_Get_count(&status, MPI_BYTE, &count));
+            // A message that has exactly the requested elements is received in place.
+            if ((size_t) count == size) {
+                incoming_messages.erase(incoming_messages.begin() + index);
+                check_MPI_error(MPI_Recv(destination, count, MPI_BYTE, source, tag, MPI_COMM_WORLD, &status));
+                return;
+            }
+            message.data.resize(count);
+            message.position = 0;
+            check_MPI_error(MPI_Recv(message.data.data(), count, MPI_BYTE, source, tag, MPI_COMM_WORLD, &status));
+        }
+        size_t length = std::min(size, message.data.size() - message.position);
+        memcpy(destination, message.data.data() + message.position, length);
+        message.position += length;
+        destination += length;
+        size -= length;
+        if (message.position == message.data.size()) {
+            incoming_messages.erase(incoming_messages.begin() + index);
+        }
+    }
+}
+
+// Release the flushed messages that were sent, waiting for all of them if
+// \p wait is true.
+void complete_sent_messages(bool wait)
+{
+    for (auto it = sent_messages.begin(); it != sent_messages.end();) {
+        int done = 1;
+        if (wait) {
+            check_MPI_error(MPI_Wait(&it->request, MPI_STATUS_IGNORE));
+        } else {
+            check_MPI_error(MPI_Test(&it->request, &done, MPI_STATUS_IGNORE));
+        }
+        it = done ? sent_messages.erase(it) : std::next(it);
+    }
+}
+
+}
+
 int tiramisu_MPI_init() {
     int provided = -1;
     MPI_Init_thread(NULL, NULL, MPI_THREAD_FUNNELED, &provided);
@@ -15,7 +350,34 @@ int tiramisu_MPI_init() {
 }
 
 void tiramisu_MPI_cleanup() {
+    for (vector_datatype_t &t : vector_datatypes) {
+        MPI_Type_free(&t.type);
+    }
+    vector_datatypes.clear();
+    for (window_t &w : windows) {
+        MPI_Win_free(&w.win);
+    }
+    windows.clear();
+    for (node_segment_t &segment : node_segments) {
+        MPI_Win_unlock_all(segment.win);
+        MPI_Win_free(&segment.win);
+    }
+    node_segments.clear();
+    if (node_comm != MPI_COMM_NULL) {
+        MPI_Comm_free(&node_comm);
+    }
     MPI_Finalize();
+    for (MPI_Request *block : request_blocks) {
+        free(block);
+    }
+    request_blocks.clear();
+    free_requests.clear();
+    pool_size = 0;
+    persistent_requests.clear();
+    posted_requests.clear();
+    outgoing_messages.clear();
+    sent_messages.clear();
+    incoming_messages.clear();
 }
 
 void tiramisu_MPI_global_barrier() {
@@ -39,17 +401,94 @@ void tiramisu_MPI_Ssend_##suffix(int count, int dest, int tag, c_datatype *data)
 #define make_Isend(suffix, c_datatype, mpi_datatype) \
 void tiramisu_MPI_Isend_##suffix(int count, int dest, int tag, c_datatype *data, long *reqs) \
 { \
-    ((MPI_Request**)reqs)[0] = (MPI_Request*)malloc(sizeof(MPI_Request)); \
+    ((MPI_Request**)reqs)[0] = acquire_request(); \
     check_MPI_error(MPI_Isend(data, count, mpi_datatype, dest, tag, MPI_COMM_WORLD, ((MPI_Request**)reqs)[0])); \
 }
 
 #define make_Issend(suffix, c_datatype, mpi_datatype) \
 void tiramisu_MPI_Issend_##suffix(int count, int dest, int tag, c_datatype *data, long *reqs) \
 { \
-    ((MPI_Request**)reqs)[0] = (MPI_Request*)malloc(sizeof(MPI_Request)); \
+    ((MPI_Request**)reqs)[0] = acquire_request(); \
     check_MPI_error(MPI_Issend(data, count, mpi_datatype, dest, tag, MPI_COMM_WORLD, ((MPI_Request**)reqs)[0])); \
 }
 
+#define make_Send_init(suffix, c_datatype, mpi_datatype) \
+int tiramisu_MPI_Send_init_##suffix(int request, int active, int count, int dest, int tag, \
+                                    c_datatype *data) \
+{ \
+    if (active) { \
+        check_MPI_error(MPI_Send_init(data, count, mpi_datatype, dest, tag, MPI_COMM_WORLD, \
+                                      &persistent_requests[request])); \
+    } \
+    return 0; \
+}
+
+#define make_Ssend_init(suffix, c_datatype, mpi_datatype) \
+int tiramisu_MPI_Ssend_init_##suffix(int request, int active, int count, int dest, int tag, \
+                                     c_datatype *data) \
+{ \
+    if (active) { \
+        check_MPI_error(MPI_Ssend_init(data, count, mpi_datatype, dest, tag, MPI_COMM_WORLD, \
+                                       &persistent_requests[request])); \
+    } \
+    return 0; \
+}
+
+#define make_Recv_init(suffix, c_datatype, mpi_datatype) \
+int tiramisu_MPI_Recv_init_##suffix(int request, int active, int count, int source, int tag, \
+                                    c_datatype *store_in) \
+{ \
+    if (active) { \
+        check_MPI_error(MPI_Recv_init(store_in, count, mpi_datatype, source, tag, MPI_COMM_WORLD, \
+                                      &persistent_requests[request])); \
+    } \
+    return 0; \
+}
+
+#define make_Send_aggregated(suffix, c_datatype, mpi_datatype) \
+void tiramisu_MPI_Send_aggregated_##suffix(int count, int dest, int tag, c_datatype *data) \
+{ \
+    append_aggregated(dest, tag, data, count * sizeof(c_datatype)); \
+}
+
+#define make_Recv_aggregated(suffix, c_datatype, mpi_datatype) \
+void tiramisu_MPI_Recv_aggregated_##suffix(int count, int source, int tag, c_datatype *store_in) \
+{ \
+    read_aggregated(source, tag, store_in, count * sizeof(c_datatype)); \
+}
+
+// Strided transfers: \p blocks blocks of \p block_length elements, the
+// beginnings of two consecutive blocks being \p stride elements apart.
+#define make_send_vector(op, suffix, c_datatype, mpi_datatype) \
+void tiramisu_MPI_##op##_vector_##suffix(int blocks, int block_length, int stride, int dest, int tag, \
+                                         c_datatype *data) \
+{ \
+    if (block_length * (int) sizeof(c_datatype) >= strided_pack_threshold) { \
+        MPI_Datatype type = get_vector_datatype(blocks, block_length, stride, mpi_datatype); \
+        check_MPI_error(MPI_##op(data, 1, type, dest, tag, MPI_COMM_WORLD)); \
+    } else { \
+        c_datatype *packed = (c_datatype *) get_packed_data(blocks * block_length * sizeof(c_datatype)); \
+        pack_blocks(packed, data, blocks, block_length, stride); \
+        check_MPI_error(MPI_##op(packed, blocks * block_length, mpi_datatype, dest, tag, MPI_COMM_WORLD)); \
+    } \
+}
+
+#define make_Recv_vector(suffix, c_datatype, mpi_datatype) \
+void tiramisu_MPI_Recv_vector_##suffix(int blocks, int block_length, int stride, int source, int tag, \
+                                       c_datatype *store_in) \
+{ \
+    MPI_Status status; \
+    if (block_length * (int) sizeof(c_datatype) >= strided_pack_threshold) { \
+        MPI_Datatype type = get_vector_datatype(blocks, block_length, stride, mpi_datatype); \
+        check_MPI_error(MPI_Recv(store_in, 1, type, source, tag, MPI_COMM_WORLD, &status)); \
+    } else { \
+        c_datatype *packed = (c_datatype *) get_packed_data(blocks * block_length * sizeof(c_datatype)); \
+        check_MPI_error(MPI_Recv(packed, blocks * block_length, mpi_datatype, source, tag, MPI_COMM_WORLD, \
+                                 &status)); \
+        unpack_blocks(store_in, packed, blocks, block_length, stride); \
+    } \
+}
+
 #define make_Recv(suffix, c_datatype, mpi_datatype) \
 void tiramisu_MPI_Recv_##suffix(int count, int source, int tag, \
                                 c_datatype *store_in) \
@@ -62,11 +501,130 @@ void tiramisu_MPI_Recv_##suffix(int count, int source, int tag, \
 void tiramisu_MPI_Irecv_##suffix(int count, int source, int tag, \
                                  c_datatype *store_in, long *reqs) \
 { \
-    ((MPI_Request**)reqs)[0] = (MPI_Request*)malloc(sizeof(MPI_Request)); \
+    ((MPI_Request**)reqs)[0] = acquire_request(); \
     check_MPI_error(MPI_Irecv(store_in, count, mpi_datatype, source, tag, MPI_COMM_WORLD, \
                               ((MPI_Request**)reqs)[0])); \
 }
 
+// Posted transfers take the same arguments as the blocking ones.
+#define make_send_posted(op, suffix, c_datatype, mpi_datatype) \
+void tiramisu_MPI_##op##_posted_##suffix(int count, int dest, int tag, c_datatype *data) \
+{ \
+    posted_requests.push_back(MPI_REQUEST_NULL); \
+    check_MPI_error(MPI_##op(data, count, mpi_datatype, dest, tag, MPI_COMM_WORLD, &posted_requests.back())); \
+}
+
+#define make_Irecv_posted(suffix, c_datatype, mpi_datatype) \
+void tiramisu_MPI_Irecv_posted_##suffix(int count, int source, int tag, c_datatype *store_in) \
+{ \
+    posted_requests.push_back(MPI_REQUEST_NULL); \
+    check_MPI_error(MPI_Irecv(store_in, count, mpi_datatype, source, tag, MPI_COMM_WORLD, \
+                              &posted_requests.back())); \
+}
+
+// Collectives.  The contribution of the rank is \p data and the result is
+// stored in \p store_in.  The nonblocking versions are posted (see above).
+#define make_Allreduce_op(op_name, mpi_op, suffix, c_datatype, mpi_datatype) \
+void tiramisu_MPI_Allreduce_##op_name##_##suffix(int count, c_datatype *data, c_datatype *store_in) \
+{ \
+    check_MPI_error(MPI_Allreduce(data == store_in ? MPI_IN_PLACE : data, store_in, count, mpi_datatype, \
+                                  mpi_op, MPI_COMM_WORLD)); \
+} \
+void tiramisu_MPI_Iallreduce_##op_name##_##suffix(int count, c_datatype *data, c_datatype *store_in) \
+{ \
+    posted_requests.push_back(MPI_REQUEST_NULL); \
+    check_MPI_error(MPI_Iallreduce(data == store_in ? MPI_IN_PLACE : data, store_in, count, mpi_datatype, \
+                                   mpi_op, MPI_COMM_WORLD, &posted_requests.back())); \
+}
+
+#define make_Allreduce(suffix, c_datatype, mpi_datatype) \
+make_Allreduce_op(sum, MPI_SUM, suffix, c_datatype, mpi_datatype) \
+make_Allreduce_op(max, MPI_MAX, suffix, c_datatype, mpi_datatype) \
+make_Allreduce_op(min, MPI_MIN, suffix, c_datatype, mpi_datatype)
+
+// Each rank gets count/number_of_ranks elements of the reduction.
+#define make_Reduce_scatter_op(op_name, mpi_op, suffix, c_datatype, mpi_datatype) \
+void tiramisu_MPI_Reduce_scatter_##op_name##_##suffix(int count, c_datatype *data, c_datatype *store_in) \
+{ \
+    int block_size = reduce_scatter_block_size(count); \
+    check_MPI_error(MPI_Reduce_scatter_block(data == store_in ? MPI_IN_PLACE : data, store_in, block_size, \
+                                             mpi_datatype, mpi_op, MPI_COMM_WORLD)); \
+} \
+void tiramisu_MPI_Ireduce_scatter_##op_name##_##suffix(int count, c_datatype *data, c_datatype *store_in) \
+{ \
+    int block_size = reduce_scatter_block_size(count); \
+    posted_requests.push_back(MPI_REQUEST_NULL); \
+    check_MPI_error(MPI_Ireduce_scatter_block(data == store_in ? MPI_IN_PLACE : data, store_in, block_size, \
+                                              mpi_datatype, mpi_op, MPI_COMM_WORLD, &posted_requests.back())); \
+}
+
+#define make_Reduce_scatter(suffix, c_datatype, mpi_datatype) \
+make_Reduce_scatter_op(sum, MPI_SUM, suffix, c_datatype, mpi_datatype) \
+make_Reduce_scatter_op(max, MPI_MAX, suffix, c_datatype, mpi_datatype) \
+make_Reduce_scatter_op(min, MPI_MIN, suffix, c_datatype, mpi_datatype)
+
+// The root copies its contribution to \p store_in, which is then broadcast.
+#define make_Bcast(suffix, c_datatype, mpi_datatype) \
+void tiramisu_MPI_Bcast_##suffix(int count, int root, c_datatype *data, c_datatype *store_in) \
+{ \
+    int rank; \
+    check_MPI_error(MPI_Comm_rank(MPI_COMM_WORLD, &rank)); \
+    if (rank == root && data != store_in) { \
+        memcpy(store_in, data, count * sizeof(c_datatype)); \
+    } \
+    check_MPI_error(MPI_Bcast(store_in, count, mpi_datatype, root, MPI_COMM_WORLD)); \
+} \
+void tiramisu_MPI_Ibcast_##suffix(int count, int root, c_datatype *data, c_datatype *store_in) \
+{ \
+    int rank; \
+    check_MPI_error(MPI_Comm_rank(MPI_COMM_WORLD, &rank)); \
+    if (rank == root && data != store_in) { \
+        memcpy(store_in, data, count * sizeof(c_datatype)); \
+    } \
+    posted_requests.push_back(MPI_REQUEST_NULL); \
+    check_MPI_error(MPI_Ibcast(store_in, count, mpi_datatype, root, MPI_COMM_WORLD, &posted_requests.back())); \
+}
+
+// The contribution of rank r is stored at store_in + r * count.
+#define make_Allgather(suffix, c_datatype, mpi_datatype) \
+void tiramisu_MPI_Allgather_##suffix(int count, c_datatype *data, c_datatype *store_in) \
+{ \
+    check_MPI_error(MPI_Allgather(data, count, mpi_datatype, store_in, count, mpi_datatype, MPI_COMM_WORLD)); \
+} \
+void tiramisu_MPI_Iallgather_##suffix(int count, c_datatype *data, c_datatype *store_in) \
+{ \
+    posted_requests.push_back(MPI_REQUEST_NULL); \
+    check_MPI_error(MPI_Iallgather(data, count, mpi_datatype, store_in, count, mpi_datatype, MPI_COMM_WORLD, \
+                                   &posted_requests.back())); \
+}
+
+// The displacement is in bytes (the windows are created with a unit of 1).
+#define make_Put(suffix, c_datatype, mpi_datatype) \
+void tiramisu_MPI_Put_##suffix(int count, int target, c_datatype *data, c_datatype *store_in) \
+{ \
+    window_t &w = find_window(store_in); \
+    char *shared = get_node_shared_address(w, store_in, target); \
+    if (shared != NULL) { \
+        memcpy(shared, data, count * sizeof(c_datatype)); \
+        return; \
+    } \
+    check_MPI_error(MPI_Put(data, count, mpi_datatype, target, (char *) store_in - w.base, count, mpi_datatype, \
+                            w.win)); \
+}
+
+#define make_Get(suffix, c_datatype, mpi_datatype) \
+void tiramisu_MPI_Get_##suffix(int count, int source, c_datatype *data, c_datatype *store_in) \
+{ \
+    window_t &w = find_window(data); \
+    char *shared = get_node_shared_address(w, data, source); \
+    if (shared != NULL) { \
+        memcpy(store_in, shared, count * sizeof(c_datatype)); \
+        return; \
+    } \
+    check_MPI_error(MPI_Get(store_in, count, mpi_datatype, source, (char *) data - w.base, count, mpi_datatype, \
+                            w.win)); \
+}
+
 inline void check_MPI_error(int ret_val) 
 {
     if (ret_val != MPI_SUCCESS) {
@@ -86,6 +644,62 @@ void tiramisu_MPI_Wait(void *request)
 {
     MPI_Status status;
     check_MPI_error(MPI_Wait((MPI_Request*)request, &status));
+    release_request((MPI_Request*)request);
+}
+
+int tiramisu_MPI_request_pool_reserve(int count)
+{
+    if ((int) free_requests.size() < count) {
+        grow_request_pool(count - free_requests.size());
+    }
+    return 0;
+}
+
+int tiramisu_MPI_Waitall(int count, void **requests)
+{
+    gather_requests(count, requests);
+    if (!batch_requests.empty()) {
+        check_MPI_error(MPI_Waitall(batch_requests.size(), batch_requests.data(), MPI_STATUSES_IGNORE));
+        for (MPI_Request *request : batch_slots) {
+            release_request(request);
+        }
+    }
+    for (int i = 0; i < count; i++) {
+        requests[i] = NULL;
+    }
+    return 0;
+}
+
+int tiramisu_MPI_Testsome(int count, void **requests)
+{
+    gather_requests(count, requests);
+    if (batch_requests.empty()) {
+        return 0;
+    }
+    int completed = 0;
+    batch_indices.resize(batch_requests.size());
+    check_MPI_error(MPI_Testsome(batch_requests.size(), batch_requests.data(), &completed,
+                                 batch_indices.data(), MPI_STATUSES_IGNORE));
+    if (completed == MPI_UNDEFINED) {
+        return 0;
+    }
+    for (int i = 0; i < completed; i++) {
+        MPI_Request *request = batch_slots[batch_indices[i]];
+        release_request(request);
+        for (int j = 0; j < count; j++) {
+            if (requests[j] == request) {
+                requests[j] = NULL;
+                break;
+            }
+        }
+    }
+    // The requests that are still pending keep their slot.
+    for (int i = 0; i < (int) batch_requests.size(); i++) {
+        if (batch_requests[i] != MPI_REQUEST_NULL) {
+            *batch_slots[i] = batch_requests[i];
+        }
+    }
+    return completed;
 }
 
 void tiramisu_MPI_Send(int count, int dest, int tag, char *data, MPI_Datatype type) 
@@ -122,7 +736,7 @@ make_Ssend(f64, double, MPI_DOUBLE)
 
 void tiramisu_MPI_Isend(int count, int dest, int tag, char *data, MPI_Datatype type, long *reqs) 
 {
-    ((MPI_Request**)reqs)[0] = (MPI_Request*)malloc(sizeof(MPI_Request));
+    ((MPI_Request**)reqs)[0] = acquire_request();
     check_MPI_error(MPI_Isend(data, count, type, dest, tag, MPI_COMM_WORLD, ((MPI_Request**)reqs)[0]));
 }
 
@@ -139,7 +753,7 @@ make_Isend(f64, double, MPI_DOUBLE)
 
 void tiramisu_MPI_Issend(int count, int dest, int tag, char *data, MPI_Datatype type, long *reqs) 
 {
-    ((MPI_Request**)reqs)[0] = (MPI_Request*)malloc(sizeof(MPI_Request));
+    ((MPI_Request**)reqs)[0] = acquire_request();
     check_MPI_error(MPI_Issend(data, count, type, dest, tag, MPI_COMM_WORLD, ((MPI_Request**)reqs)[0]));
 }
 
@@ -175,7 +789,7 @@ make_Recv(f64, double, MPI_DOUBLE)
 void tiramisu_MPI_Irecv(int count, int source, int tag,
                       char *store_in, MPI_Datatype type, long *reqs) 
 {
-    ((MPI_Request**)reqs)[0] = (MPI_Request*)malloc(sizeof(MPI_Request));
+    ((MPI_Request**)reqs)[0] = acquire_request();
     check_MPI_error(MPI_Irecv(store_in, count, type, source, tag, MPI_COMM_WORLD,
                               ((MPI_Request**)reqs)[0]));
 }
@@ -191,6 +805,372 @@ make_Irecv(uint64, unsigned long, MPI_UNSIGNED_LONG)
 make_Irecv(f32, float, MPI_FLOAT)
 make_Irecv(f64, double, MPI_DOUBLE)
 
+make_send_vector(Send, int8, char, MPI_SIGNED_CHAR)
+make_send_vector(Send, uint8, unsigned char, MPI_UNSIGNED_CHAR)
+make_send_vector(Send, int16, short, MPI_SHORT)
+make_send_vector(Send, uint16, unsigned short, MPI_UNSIGNED_SHORT)
+make_send_vector(Send, int32, int, MPI_INT)
+make_send_vector(Send, uint32, unsigned int, MPI_UNSIGNED)
+make_send_vector(Send, int64, long, MPI_LONG)
+make_send_vector(Send, uint64, unsigned long, MPI_UNSIGNED_LONG)
+make_send_vector(Send, f32, float, MPI_FLOAT)
+make_send_vector(Send, f64, double, MPI_DOUBLE)
+
+make_send_vector(Ssend, int8, char, MPI_SIGNED_CHAR)
+make_send_vector(Ssend, uint8, unsigned char, MPI_UNSIGNED_CHAR)
+make_send_vector(Ssend, int16, short, MPI_SHORT)
+make_send_vector(Ssend, uint16, unsigned short, MPI_UNSIGNED_SHORT)
+make_send_vector(Ssend, int32, int, MPI_INT)
+make_send_vector(Ssend, uint32, unsigned int, MPI_UNSIGNED)
+make_send_vector(Ssend, int64, long, MPI_LONG)
+make_send_vector(Ssend, uint64, unsigned long, MPI_UNSIGNED_LONG)
+make_send_vector(Ssend, f32, float, MPI_FLOAT)
+make_send_vector(Ssend, f64, double, MPI_DOUBLE)
+
+make_Recv_vector(int8, char, MPI_SIGNED_CHAR)
+make_Recv_vector(uint8, unsigned char, MPI_UNSIGNED_CHAR)
+make_Recv_vector(int16, short, MPI_SHORT)
+make_Recv_vector(uint16, unsigned short, MPI_UNSIGNED_SHORT)
+make_Recv_vector(int32, int, MPI_INT)
+make_Recv_vector(uint32, unsigned int, MPI_UNSIGNED)
+make_Recv_vector(int64, long, MPI_LONG)
+make_Recv_vector(uint64, unsigned long, MPI_UNSIGNED_LONG)
+make_Recv_vector(f32, float, MPI_FLOAT)
+make_Recv_vector(f64, double, MPI_DOUBLE)
+
+make_send_posted(Isend, int8, char, MPI_SIGNED_CHAR)
+make_send_posted(Isend, uint8, unsigned char, MPI_UNSIGNED_CHAR)
+make_send_posted(Isend, int16, short, MPI_SHORT)
+make_send_posted(Isend, uint16, unsigned short, MPI_UNSIGNED_SHORT)
+make_send_posted(Isend, int32, int, MPI_INT)
+make_send_posted(Isend, uint32, unsigned int, MPI_UNSIGNED)
+make_send_posted(Isend, int64, long, MPI_LONG)
+make_send_posted(Isend, uint64, unsigned long, MPI_UNSIGNED_LONG)
+make_send_posted(Isend, f32, float, MPI_FLOAT)
+make_send_posted(Isend, f64, double, MPI_DOUBLE)
+
+make_send_posted(Issend, int8, char, MPI_SIGNED_CHAR)
+make_send_posted(Issend, uint8, unsigned char, MPI_UNSIGNED_CHAR)
+make_send_posted(Issend, int16, short, MPI_SHORT)
+make_send_posted(Issend, uint16, unsigned short, MPI_UNSIGNED_SHORT)
+make_send_posted(Issend, int32, int, MPI_INT)
+make_send_posted(Issend, uint32, unsigned int, MPI_UNSIGNED)
+make_send_posted(Issend, int64, long, MPI_LONG)
+make_send_posted(Issend, uint64, unsigned long, MPI_UNSIGNED_LONG)
+make_send_posted(Issend, f32, float, MPI_FLOAT)
+make_send_posted(Issend, f64, double, MPI_DOUBLE)
+
+make_Irecv_posted(int8, char, MPI_SIGNED_CHAR)
+make_Irecv_posted(uint8, unsigned char, MPI_UNSIGNED_CHAR)
+make_Irecv_posted(int16, short, MPI_SHORT)
+make_Irecv_posted(uint16, unsigned short, MPI_UNSIGNED_SHORT)
+make_Irecv_posted(int32, int, MPI_INT)
+make_Irecv_posted(uint32, unsigned int, MPI_UNSIGNED)
+make_Irecv_posted(int64, long, MPI_LONG)
+make_Irecv_posted(uint64, unsigned long, MPI_UNSIGNED_LONG)
+make_Irecv_posted(f32, float, MPI_FLOAT)
+make_Irecv_posted(f64, double, MPI_DOUBLE)
+
+void tiramisu_MPI_Wait_posted()
+{
+    if (!posted_requests.empty()) {
+        check_MPI_error(MPI_Waitall(posted_requests.size(), posted_requests.data(), MPI_STATUSES_IGNORE));
+        posted_requests.clear();
+    }
+}
+
+make_Allreduce(int8, char, MPI_SIGNED_CHAR)
+make_Allreduce(uint8, unsigned char, MPI_UNSIGNED_CHAR)
+make_Allreduce(int16, short, MPI_SHORT)
+make_Allreduce(uint16, unsigned short, MPI_UNSIGNED_SHORT)
+make_Allreduce(int32, int, MPI_INT)
+make_Allreduce(uint32, unsigned int, MPI_UNSIGNED)
+make_Allreduce(int64, long, MPI_LONG)
+make_Allreduce(uint64, unsigned long, MPI_UNSIGNED_LONG)
+make_Allreduce(f32, float, MPI_FLOAT)
+make_Allreduce(f64, double, MPI_DOUBLE)
+
+make_Reduce_scatter(int8, char, MPI_SIGNED_CHAR)
+make_Reduce_scatter(uint8, unsigned char, MPI_UNSIGNED_CHAR)
+make_Reduce_scatter(int16, short, MPI_SHORT)
+make_Reduce_scatter(uint16, unsigned short, MPI_UNSIGNED_SHORT)
+make_Reduce_scatter(int32, int, MPI_INT)
+make_Reduce_scatter(uint32, unsigned int, MPI_UNSIGNED)
+make_Reduce_scatter(int64, long, MPI_LONG)
+make_Reduce_scatter(uint64, unsigned long, MPI_UNSIGNED_LONG)
+make_Reduce_scatter(f32, float, MPI_FLOAT)
+make_Reduce_scatter(f64, double, MPI_DOUBLE)
+
+make_Bcast(int8, char, MPI_SIGNED_CHAR)
+make_Bcast(uint8, unsigned char, MPI_UNSIGNED_CHAR)
+make_Bcast(int16, short, MPI_SHORT)
+make_Bcast(uint16, unsigned short, MPI_UNSIGNED_SHORT)
+make_Bcast(int32, int, MPI_INT)
+make_Bcast(uint32, unsigned int, MPI_UNSIGNED)
+make_Bcast(int64, long, MPI_LONG)
+make_Bcast(uint64, unsigned long, MPI_UNSIGNED_LONG)
+make_Bcast(f32, float, MPI_FLOAT)
+make_Bcast(f64, double, MPI_DOUBLE)
+
+make_Allgather(int8, char, MPI_SIGNED_CHAR)
+make_Allgather(uint8, unsigned char, MPI_UNSIGNED_CHAR)
+make_Allgather(int16, short, MPI_SHORT)
+make_Allgather(uint16, unsigned short, MPI_UNSIGNED_SHORT)
+make_Allgather(int32, int, MPI_INT)
+make_Allgather(uint32, unsigned int, MPI_UNSIGNED)
+make_Allgather(int64, long, MPI_LONG)
+make_Allgather(uint64, unsigned long, MPI_UNSIGNED_LONG)
+make_Allgather(f32, float, MPI_FLOAT)
+make_Allgather(f64, double, MPI_DOUBLE)
+
+int tiramisu_MPI_Win_expose(const char *name, void *base, unsigned long size)
+{
+    window_t *window = NULL;
+    for (window_t &w : windows) {
+        if (w.name == name) {
+            window = &w;
+            break;
+        }
+    }
+    // Recreating a window is collective, so every rank recreates it as soon
+    // as the buffer changed on one of them.
+    int changed = (window == NULL || window->base != (char *) base || window->size != size);
+    check_MPI_error(MPI_Allreduce(MPI_IN_PLACE, &changed, 1, MPI_INT, MPI_LOR, MPI_COMM_WORLD));
+    if (changed) {
+        if (window == NULL) {
+            windows.push_back(window_t());
+            window = &windows.back();
+            window->name = name;
+        } else {
+            check_MPI_error(MPI_Win_free(&window->win));
+        }
+        window->base = (char *) base;
+        window->size = size;
+        window->shared_win = MPI_WIN_NULL;
+        window->peer_bases.clear();
+        for (const node_segment_t &segment : node_segments) {
+            if (segment.base == (char *) base && size <= segment.size) {
+                window->shared_win = segment.win;
+                window->peer_bases = segment.peer_bases;
+                break;
+            }
+        }
+        check_MPI_error(MPI_Win_create(base, size, 1, MPI_INFO_NULL, MPI_COMM_WORLD, &window->win));
+    }
+    return 0;
+}
+
+int tiramisu_MPI_Win_fence(const char *name)
+{
+    for (window_t &w : windows) {
+        if (w.name == name) {
+            // The copies between the ranks of the node are completed by a
+            // memory barrier and a barrier on the node.
+            if (w.shared_win != MPI_WIN_NULL) {
+                check_MPI_error(MPI_Win_sync(w.shared_win));
+            }
+            check_MPI_error(MPI_Win_fence(0, w.win));
+            if (w.shared_win != MPI_WIN_NULL) {
+                check_MPI_error(MPI_Barrier(node_comm));
+                check_MPI_error(MPI_Win_sync(w.shared_win));
+            }
+            return 0;
+        }
+    }
+    assert(false && "Fence on a window that is not exposed.");
+    return 0;
+}
+
+void *tiramisu_MPI_alloc_node_shared(unsigned long size)
+{
+    init_node_comm();
+    node_segment_t segment;
+    segment.size = size;
+    check_MPI_error(MPI_Win_allocate_shared(size, 1, MPI_INFO_NULL, node_comm, &segment.base, &segment.win));
+    int node_size;
+    check_MPI_error(MPI_Comm_size(node_comm, &node_size));
+    segment.peer_bases.resize(node_size);
+    for (int i = 0; i < node_size; i++) {
+        MPI_Aint peer_size;
+        int disp_unit;
+        check_MPI_error(MPI_Win_shared_query(segment.win, i, &peer_size, &disp_unit, &segment.peer_bases[i]));
+    }
+    check_MPI_error(MPI_Win_lock_all(MPI_MODE_NOCHECK, segment.win));
+    node_segments.push_back(segment);
+    return segment.base;
+}
+
+int tiramisu_MPI_free_node_shared(void *base)
+{
+    for (size_t i = 0; i < node_segments.size(); i++) {
+        if (node_segments[i].base == (char *) base) {
+            // The windows of the segment are freed with it (every rank frees
+            // the same segments in the same order); they are created again
+            // if the memory is exposed again.
+            for (auto it = windows.begin(); it != windows.end();) {
+                if (it->shared_win == node_segments[i].win) {
+                    check_MPI_error(MPI_Win_free(&it->win));
+                    it = windows.erase(it);
+                } else {
+                    it++;
+                }
+            }
+            check_MPI_error(MPI_Win_unlock_all(node_segments[i].win));
+            check_MPI_error(MPI_Win_free(&node_segments[i].win));
+            node_segments.erase(node_segments.begin() + i);
+            return 0;
+        }
+    }
+    assert(false && "Freeing memory that was not allocated by tiramisu_MPI_alloc_node_shared().");
+    return 0;
+}
+
+make_Put(int8, char, MPI_SIGNED_CHAR)
+make_Put(uint8, unsigned char, MPI_UNSIGNED_CHAR)
+make_Put(int16, short, MPI_SHORT)
+make_Put(uint16, unsigned short, MPI_UNSIGNED_SHORT)
+make_Put(int32, int, MPI_INT)
+make_Put(uint32, unsigned int, MPI_UNSIGNED)
+make_Put(int64, long, MPI_LONG)
+make_Put(uint64, unsigned long, MPI_UNSIGNED_LONG)
+make_Put(f32, float, MPI_FLOAT)
+make_Put(f64, double, MPI_DOUBLE)
+
+make_Get(int8, char, MPI_SIGNED_CHAR)
+make_Get(uint8, unsigned char, MPI_UNSIGNED_CHAR)
+make_Get(int16, short, MPI_SHORT)
+make_Get(uint16, unsigned short, MPI_UNSIGNED_SHORT)
+make_Get(int32, int, MPI_INT)
+make_Get(uint32, unsigned int, MPI_UNSIGNED)
+make_Get(int64, long, MPI_LONG)
+make_Get(uint64, unsigned long, MPI_UNSIGNED_LONG)
+make_Get(f32, float, MPI_FLOAT)
+make_Get(f64, double, MPI_DOUBLE)
+
+int tiramisu_MPI_persistent_requests(int count)
+{
+    int first = persistent_requests.size();
+    persistent_requests.resize(first + count, MPI_REQUEST_NULL);
+    return first;
+}
+
+make_Send_init(int8, char, MPI_SIGNED_CHAR)
+make_Send_init(uint8, unsigned char, MPI_UNSIGNED_CHAR)
+make_Send_init(int16, short, MPI_SHORT)
+make_Send_init(uint16, unsigned short, MPI_UNSIGNED_SHORT)
+make_Send_init(int32, int, MPI_INT)
+make_Send_init(uint32, unsigned int, MPI_UNSIGNED)
+make_Send_init(int64, long, MPI_LONG)
+make_Send_init(uint64, unsigned long, MPI_UNSIGNED_LONG)
+make_Send_init(f32, float, MPI_FLOAT)
+make_Send_init(f64, double, MPI_DOUBLE)
+
+make_Ssend_init(int8, char, MPI_SIGNED_CHAR)
+make_Ssend_init(uint8, unsigned char, MPI_UNSIGNED_CHAR)
+make_Ssend_init(int16, short, MPI_SHORT)
+make_Ssend_init(uint16, unsigned short, MPI_UNSIGNED_SHORT)
+make_Ssend_init(int32, int, MPI_INT)
+make_Ssend_init(uint32, unsigned int, MPI_UNSIGNED)
+make_Ssend_init(int64, long, MPI_LONG)
+make_Ssend_init(uint64, unsigned long, MPI_UNSIGNED_LONG)
+make_Ssend_init(f32, float, MPI_FLOAT)
+make_Ssend_init(f64, double, MPI_DOUBLE)
+
+make_Recv_init(int8, char, MPI_SIGNED_CHAR)
+make_Recv_init(uint8, unsigned char, MPI_UNSIGNED_CHAR)
+make_Recv_init(int16, short, MPI_SHORT)
+make_Recv_init(uint16, unsigned short, MPI_UNSIGNED_SHORT)
+make_Recv_init(int32, int, MPI_INT)
+make_Recv_init(uint32, unsigned int, MPI_UNSIGNED)
+make_Recv_init(int64, long, MPI_LONG)
+make_Recv_init(uint64, unsigned long, MPI_UNSIGNED_LONG)
+make_Recv_init(f32, float, MPI_FLOAT)
+make_Recv_init(f64, double, MPI_DOUBLE)
+
+int tiramisu_MPI_Startall(int first, int count)
+{
+    batch_requests.clear();
+    batch_indices.clear();
+    for (int i = first; i < first + count; i++) {
+        if (persistent_requests[i] != MPI_REQUEST_NULL) {
+            batch_requests.push_back(persistent_requests[i]);
+            batch_indices.push_back(i);
+        }
+    }
+    if (!batch_requests.empty()) {
+        check_MPI_error(MPI_Startall(batch_requests.size(), batch_requests.data()));
+        for (int i = 0; i < (int) batch_indices.size(); i++) {
+            persistent_requests[batch_indices[i]] = batch_requests[i];
+        }
+    }
+    return 0;
+}
+
+int tiramisu_MPI_Waitall_persistent(int first, int count)
+{
+    // Inactive (MPI_REQUEST_NULL) requests are ignored by MPI_Waitall.
+    check_MPI_error(MPI_Waitall(count, &persistent_requests[first], MPI_STATUSES_IGNORE));
+    return 0;
+}
+
+int tiramisu_MPI_persistent_requests_free(int first, int count)
+{
+    for (int i = first; i < first + count; i++) {
+        if (persistent_requests[i] != MPI_REQUEST_NULL) {
+            check_MPI_error(MPI_Request_free(&persistent_requests[i]));
+        }
+    }
+    if (first + count == (int) persistent_requests.size()) {
+        persistent_requests.resize(first);
+    }
+    return 0;
+}
+
+
+int tiramisu_MPI_aggregated_flush()
+{
+    for (aggregated_message_t &message : outgoing_messages) {
+        sent_messages.push_back(aggregated_message_t());
+        aggregated_message_t &sent = sent_messages.back();
+        sent.peer = message.peer;
+        sent.tag = message.tag;
+        sent.data.swap(message.data);
+        check_MPI_error(MPI_Isend(sent.data.data(), sent.data.size(), MPI_BYTE, sent.peer, sent.tag,
+                                  MPI_COMM_WORLD, &sent.request));
+    }
+    outgoing_messages.clear();
+    complete_sent_messages(false);
+    return 0;
+}
+
+int tiramisu_MPI_aggregated_wait()
+{
+    complete_sent_messages(true);
+    return 0;
+}
+
+make_Send_aggregated(int8, char, MPI_SIGNED_CHAR)
+make_Send_aggregated(uint8, unsigned char, MPI_UNSIGNED_CHAR)
+make_Send_aggregated(int16, short, MPI_SHORT)
+make_Send_aggregated(uint16, unsigned short, MPI_UNSIGNED_SHORT)
+make_Send_aggregated(int32, int, MPI_INT)
+make_Send_aggregated(uint32, unsigned int, MPI_UNSIGNED)
+make_Send_aggregated(int64, long, MPI_LONG)
+make_Send_aggregated(uint64, unsigned long, MPI_UNSIGNED_LONG)
+make_Send_aggregated(f32, float, MPI_FLOAT)
+make_Send_aggregated(f64, double, MPI_DOUBLE)
+
+make_Recv_aggregated(int8, char, MPI_SIGNED_CHAR)
+make_Recv_aggregated(uint8, unsigned char, MPI_UNSIGNED_CHAR)
+make_Recv_aggregated(int16, short, MPI_SHORT)
+make_Recv_aggregated(uint16, unsigned short, MPI_UNSIGNED_SHORT)
+make_Recv_aggregated(int32, int, MPI_INT)
+make_Recv_aggregated(uint32, unsigned int, MPI_UNSIGNED)
+make_Recv_aggregated(int64, long, MPI_LONG)
+make_Recv_aggregated(uint64, unsigned long, MPI_UNSIGNED_LONG)
+make_Recv_aggregated(f32, float, MPI_FLOAT)
+make_Recv_aggregated(f64, double, MPI_DOUBLE)
+
 }
 
 #endif
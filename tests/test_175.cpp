@@ -0,0 +1,40 @@
+#include <tiramisu/tiramisu.h>
+
+using namespace tiramisu;
+
+int gen(std::string name, int size)
+{
+    tiramisu::init(name);
+
+    tiramisu::var i("i", 0, size), j("j", 0, size);
+
+    tiramisu::input A("A", {i, j}, p_float32);
+
+    // T is traversed column-wise: consecutive iterations of the innermost
+    // loop access elements that are size*4 bytes apart.
+    tiramisu::computation T({i, j}, A(i, j) + 1.0f);
+    tiramisu::computation O({i, j}, T(i, j) * 2.0f);
+
+    T.interchange(i, j);
+    T.then(O, computation::root);
+
+    // The temporary buffer of T gets padded, A and O do not.
+    global::get_implicit_function()->set_automatic_buffer_padding(true);
+
+    tiramisu::codegen({A.get_buffer(), O.get_buffer()}, "build/generated_fct_test_175.o");
+
+    // The inner dimension of T is padded by one cache line (16 floats).
+    const auto &t_sizes = T.get_buffer()->get_dim_sizes();
+    if ((t_sizes[0].get_int_val() != size) || (t_sizes[1].get_int_val() != size + 16))
+        return 1;
+    for (tiramisu::buffer *buf : {A.get_buffer(), O.get_buffer()})
+        if ((buf->get_dim_sizes()[0].get_int_val() != size) || (buf->get_dim_sizes()[1].get_int_val() != size))
+            return 1;
+
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    return gen("func", 256);
+}
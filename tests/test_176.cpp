@@ -0,0 +1,32 @@
+#include <tiramisu/tiramisu.h>
+
+using namespace tiramisu;
+
+void gen(std::string name, int size)
+{
+    tiramisu::init(name);
+
+    tiramisu::var i("i", 0, size), j("j", 0, size);
+    tiramisu::var i0("i0"), j0("j0"), i1("i1"), j1("j1");
+
+    tiramisu::input A("A", {i, j}, p_float32);
+
+    // Transpose A.  Each 8x8 tile of A is copied into a transposed local
+    // buffer so that the innermost loop reads it with a unit stride.
+    tiramisu::computation B({i, j}, A(j, i));
+
+    B.tile(i, j, 8, 8, i0, j0, i1, j1);
+    // The footprint (shape and offsets) of the local buffer is computed
+    // automatically.
+    B.cache_local(A, j0, {}, {}, true);
+
+    tiramisu::codegen({A.get_buffer(), B.get_buffer()}, "build/generated_fct_test_176.o");
+}
+
+int main(int argc, char **argv)
+{
+    // The size is not a multiple of the tile size to test partial tiles.
+    gen("func", 100);
+
+    return 0;
+}
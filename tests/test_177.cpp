@@ -0,0 +1,31 @@
+#include <tiramisu/tiramisu.h>
+
+using namespace tiramisu;
+
+void gen(std::string name, int size)
+{
+    tiramisu::init(name);
+
+    tiramisu::var i("i", 0, size), j("j", 0, size);
+
+    tiramisu::input A("A", {i, j}, p_int32);
+
+    tiramisu::computation B({i, j}, A(i, j) + 1);
+    tiramisu::computation C({i, j}, B(i, j) * 2);
+
+    C.after(B, computation::root);
+
+    // Prefetch the row of A used 2 iterations of i later.
+    B.prefetch(A, i, 2);
+    // Let the prefetch distance be computed automatically.
+    C.prefetch(B, i);
+
+    tiramisu::codegen({A.get_buffer(), B.get_buffer(), C.get_buffer()}, "build/generated_fct_test_177.o");
+}
+
+int main(int argc, char **argv)
+{
+    gen("func", 100);
+
+    return 0;
+}
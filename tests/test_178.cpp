@@ -0,0 +1,43 @@
+#include <tiramisu/tiramisu.h>
+
+using namespace tiramisu;
+
+int gen(std::string name, int size)
+{
+    tiramisu::init(name);
+
+    tiramisu::var i("i", 0, size), j("j", 0, size);
+    tiramisu::var j0("j0"), j1("j1");
+
+    tiramisu::input A("A", {i, j}, p_int32);
+
+    // Sum of the rows of A.
+    tiramisu::computation C_init({i}, tiramisu::expr((int32_t) 0));
+    tiramisu::computation C({i, j}, p_int32);
+    C.set_expression(C(i, 0) + A(i, j));
+
+    C.store_in({i}, {size});
+    C_init.store_in(C.get_buffer(), {i});
+
+    C.after(C_init, computation::root);
+
+    // Compute 10 partial sums per row in parallel, then combine them.
+    C.split(j, 10, j0, j1);
+    tiramisu::computation *C_rf = C.rfactor(j0);
+    C_rf->parallelize(j0);
+
+    tiramisu::codegen({A.get_buffer(), C.get_buffer()}, "build/generated_fct_test_178.o");
+
+    // The partial sums of each value of j0 are contiguous (j0 is the
+    // outermost dimension of the partial buffer).
+    const auto &part_sizes = C_rf->get_buffer()->get_dim_sizes();
+    if ((part_sizes.size() != 2) || (part_sizes[0].get_int_val() != 10) || (part_sizes[1].get_int_val() != size))
+        return 1;
+
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    return gen("func", 100);
+}
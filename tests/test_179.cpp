@@ -0,0 +1,46 @@
+#include <tiramisu/tiramisu.h>
+
+using namespace tiramisu;
+
+void gen(std::string name, int size, int bins)
+{
+    tiramisu::init(name);
+
+    tiramisu::var i("i", 0, size), k("k", 0, bins);
+    tiramisu::var i0("i0"), i1("i1");
+
+    tiramisu::input A("A", {i}, p_int32);
+
+    // Two histograms of the values of A: the element i of A is added to
+    // the bin i % bins.
+    tiramisu::computation H_init({k}, tiramisu::expr((int32_t) 0));
+    tiramisu::computation H({i}, H_init(i % bins) + A(i));
+    tiramisu::computation G_init({k}, tiramisu::expr((int32_t) 0));
+    tiramisu::computation G({i}, G_init(i % bins) + A(i));
+
+    tiramisu::buffer b_H("b_H", {bins}, p_int32, a_output);
+    tiramisu::buffer b_G("b_G", {bins}, p_int32, a_output);
+    H_init.store_in(&b_H, {k});
+    H.store_in(&b_H, {i % bins});
+    G_init.store_in(&b_G, {k});
+    G.store_in(&b_G, {i % bins});
+
+    H.after(H_init, computation::root);
+    G_init.after(H, computation::root);
+    G.after(G_init, computation::root);
+
+    // Parallel iterations of i update the same bins: use atomic updates
+    // for H and private histograms for G.
+    H.parallelize_update(i, u_atomic);
+    G.split(i, size / 4, i0, i1);
+    G.parallelize_update(i0, u_privatize);
+
+    tiramisu::codegen({A.get_buffer(), &b_H, &b_G}, "build/generated_fct_test_179.o");
+}
+
+int main(int argc, char **argv)
+{
+    gen("func", 1000, 16);
+
+    return 0;
+}
@@ -0,0 +1,39 @@
+#include <tiramisu/tiramisu.h>
+
+using namespace tiramisu;
+
+void gen(std::string name, int steps, int size)
+{
+    tiramisu::init(name);
+
+    tiramisu::var t("t", 1, steps), i("i", 1, size - 1), j("j", 1, size - 1);
+    tiramisu::var T("T"), P("P"), J("J"), t1("t1"), i1("i1"), j1("j1");
+
+    // 1D and 2D Jacobi-like stencils iterated over time.  All the time
+    // steps are kept, the time step 0 and the borders are set by the
+    // caller.
+    tiramisu::computation A({t, i}, p_float32);
+    A.set_expression((A(t - 1, i - 1) + A(t - 1, i) + A(t - 1, i + 1)) * 0.25f);
+    tiramisu::computation B({t, i, j}, p_float32);
+    B.set_expression((B(t - 1, i - 1, j) + B(t - 1, i + 1, j) + B(t - 1, i, j) +
+                      B(t - 1, i, j - 1) + B(t - 1, i, j + 1)) * 0.125f);
+
+    tiramisu::buffer b_A("b_A", {steps, size}, p_float32, a_output);
+    tiramisu::buffer b_B("b_B", {steps, size, size}, p_float32, a_output);
+    A.store_in(&b_A, {t, i});
+    B.store_in(&b_B, {t, i, j});
+
+    B.after(A, computation::root);
+
+    A.time_tile(t, i, 8, T, P, t1, i1);
+    B.time_tile(t, i, j, 8, 16, T, P, J, t1, i1, j1);
+
+    tiramisu::codegen({&b_A, &b_B}, "build/generated_fct_test_180.o");
+}
+
+int main(int argc, char **argv)
+{
+    gen("func", 20, 50);
+
+    return 0;
+}
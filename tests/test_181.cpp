@@ -0,0 +1,40 @@
+#include <tiramisu/tiramisu.h>
+
+using namespace tiramisu;
+
+void gen(std::string name, int size)
+{
+    tiramisu::init(name);
+
+    tiramisu::var i("i", 1, size), j("j", 1, size), j2("j", 1, size - 1);
+    tiramisu::var W("W"), P("P");
+
+    // Two in-place sweeps (Gauss-Seidel like) whose loops both carry
+    // dependences.  The borders are set by the caller.
+    tiramisu::computation A({i, j}, p_float32);
+    A.set_expression((A(i - 1, j) + A(i, j - 1)) * 0.5f);
+    tiramisu::computation B({i, j2}, p_float32);
+    B.set_expression((B(i - 1, j2 + 1) + B(i, j2 - 1)) * 0.5f);
+
+    tiramisu::buffer b_A("b_A", {size, size}, p_float32, a_output);
+    tiramisu::buffer b_B("b_B", {size, size}, p_float32, a_output);
+    A.store_in(&b_A, {i, j});
+    B.store_in(&b_B, {i, j2});
+
+    B.after(A, computation::root);
+
+    // A: the wavefronts are executed one after the other, the points of a
+    // wavefront in parallel.  B: the rows are executed in parallel, each
+    // row waits for the columns of the previous row that it reads.
+    A.wavefront(i, j, W, P);
+    B.wavefront_pipeline(i, j2);
+
+    tiramisu::codegen({&b_A, &b_B}, "build/generated_fct_test_181.o");
+}
+
+int main(int argc, char **argv)
+{
+    gen("func", 100);
+
+    return 0;
+}
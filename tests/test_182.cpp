@@ -0,0 +1,32 @@
+#include <tiramisu/tiramisu.h>
+
+using namespace tiramisu;
+
+void gen(std::string name, int batch, int channels, int size)
+{
+    tiramisu::init(name);
+
+    tiramisu::var n("n", 0, batch), c("c", 0, channels), y("y", 1, size - 1), x("x", 1, size - 1);
+    tiramisu::var y0("y", 0, size), x0("x", 0, size);
+
+    // A 3x1 filter over a batch of images.  The batch and channel loops
+    // have small trip counts, so they are collapsed with the rows.
+    tiramisu::input in("in", {n, c, y0, x0}, p_int32);
+    tiramisu::computation C({n, c, y, x}, in(n, c, y - 1, x) + in(n, c, y, x) + in(n, c, y + 1, x));
+
+    tiramisu::buffer b_in("b_in", {batch, channels, size, size}, p_int32, a_input);
+    tiramisu::buffer b_C("b_C", {batch, channels, size, size}, p_int32, a_output);
+    in.store_in(&b_in);
+    C.store_in(&b_C);
+
+    C.collapse(n, y);
+
+    tiramisu::codegen({&b_in, &b_C}, "build/generated_fct_test_182.o");
+}
+
+int main(int argc, char **argv)
+{
+    gen("func", 1, 3, 40);
+
+    return 0;
+}
@@ -0,0 +1,39 @@
+#include <tiramisu/tiramisu.h>
+
+using namespace tiramisu;
+
+void gen(std::string name, int size)
+{
+    tiramisu::init(name);
+
+    tiramisu::var i("i", 1, size), j("j", 0, size);
+
+    // The same computation parallelized with the three scheduling
+    // policies (the extent of i is not a multiple of the chunk sizes).
+    tiramisu::computation A({i, j}, tiramisu::expr(o_cast, p_int32, i * 3 + j));
+    tiramisu::computation B({i, j}, tiramisu::expr(o_cast, p_int32, i * 5 - j));
+    tiramisu::computation C({i, j}, tiramisu::expr(o_cast, p_int32, i - j * 7));
+
+    tiramisu::buffer b_A("b_A", {size, size}, p_int32, a_output);
+    tiramisu::buffer b_B("b_B", {size, size}, p_int32, a_output);
+    tiramisu::buffer b_C("b_C", {size, size}, p_int32, a_output);
+    A.store_in(&b_A);
+    B.store_in(&b_B);
+    C.store_in(&b_C);
+
+    B.after(A, computation::root);
+    C.after(B, computation::root);
+
+    A.parallelize(i, s_static, 3);
+    B.parallelize(i, s_dynamic, 4);
+    C.parallelize(i, s_guided, 2);
+
+    tiramisu::codegen({&b_A, &b_B, &b_C}, "build/generated_fct_test_183.o");
+}
+
+int main(int argc, char **argv)
+{
+    gen("func", 101);
+
+    return 0;
+}
@@ -0,0 +1,48 @@
+#include <tiramisu/tiramisu.h>
+
+using namespace tiramisu;
+
+void gen(std::string name, int size)
+{
+    tiramisu::init(name);
+
+    tiramisu::var i("i", 0, size), j("j", 0, size);
+
+    // Two independent branches (B1 and B2) between a producer (A) and a
+    // consumer (C).  The branches are executed as concurrent tasks, each
+    // of them with a parallel loop.
+    tiramisu::input in("in", {i, j}, p_int32);
+    tiramisu::computation A({i, j}, in(i, j) * 2);
+    tiramisu::computation B1({i, j}, A(i, j) + 1);
+    tiramisu::computation B2({i, j}, A(i, j) * 3);
+    tiramisu::computation C({i, j}, B1(i, j) - B2(i, j));
+
+    tiramisu::buffer b_in("b_in", {size, size}, p_int32, a_input);
+    tiramisu::buffer b_A("b_A", {size, size}, p_int32, a_output);
+    tiramisu::buffer b_B1("b_B1", {size, size}, p_int32, a_output);
+    tiramisu::buffer b_B2("b_B2", {size, size}, p_int32, a_output);
+    tiramisu::buffer b_C("b_C", {size, size}, p_int32, a_output);
+    in.store_in(&b_in);
+    A.store_in(&b_A);
+    B1.store_in(&b_B1);
+    B2.store_in(&b_B2);
+    C.store_in(&b_C);
+
+    B1.after(A, computation::root);
+    B2.after(B1, computation::root);
+    C.after(B2, computation::root);
+
+    B1.tag_task_parallel();
+    B2.tag_task_parallel();
+    B1.parallelize(i);
+    B2.parallelize(i);
+
+    tiramisu::codegen({&b_in, &b_A, &b_B1, &b_B2, &b_C}, "build/generated_fct_test_184.o");
+}
+
+int main(int argc, char **argv)
+{
+    gen("func", 64);
+
+    return 0;
+}
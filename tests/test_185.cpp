@@ -0,0 +1,80 @@
+#include <tiramisu/tiramisu.h>
+
+#include <iostream>
+#include <sstream>
+
+using namespace tiramisu;
+
+// Return the number of occurrences of \p pattern in the Halide statement
+// generated for the function \p fct.
+int count_in_halide_stmt(tiramisu::function *fct, const std::string &pattern)
+{
+    std::stringstream stmt;
+    std::streambuf *out = std::cout.rdbuf(stmt.rdbuf());
+    fct->dump_halide_stmt();
+    std::cout.rdbuf(out);
+
+    int count = 0;
+    std::string s = stmt.str();
+    for (size_t pos = s.find(pattern); pos != std::string::npos; pos = s.find(pattern, pos + 1))
+    {
+        count++;
+    }
+    return count;
+}
+
+int gen(std::string name, int size, int small)
+{
+    tiramisu::init(name);
+
+    tiramisu::var i("i", 0, size), j("j", 0, size), k("k", 0, size), l("l", 0, small);
+
+    tiramisu::input A("A", {i, k}, p_int32);
+    tiramisu::input B("B", {k, j}, p_int32);
+
+    // C = A * B, with the parallel j loop unrolled and jammed into the k
+    // loop.  The extent of j is not a multiple of the unrolling factor, so
+    // both the jammed loop and the remainder loop are parallel and
+    // distributed dynamically.
+    tiramisu::computation C_init({i, j}, tiramisu::expr((int32_t) 0));
+    tiramisu::computation C({i, j, k}, p_int32);
+    C.set_expression(C(i, j, 0) + A(i, k) * B(k, j));
+    C.store_in({i, j}, {size, size});
+    C_init.store_in(C.get_buffer(), {i, j});
+
+    // D = A * B(:, 0:small), with an unrolling factor larger than the
+    // extent of l: all the iterations are in the remainder loop.
+    tiramisu::computation D_init({i, l}, tiramisu::expr((int32_t) 0));
+    tiramisu::computation D({i, l, k}, p_int32);
+    D.set_expression(D(i, l, 0) + A(i, k) * B(k, l));
+    D.store_in({i, l}, {size, small});
+    D_init.store_in(D.get_buffer(), {i, l});
+
+    C.after(C_init, computation::root);
+    D_init.after(C, computation::root);
+    D.after(D_init, computation::root);
+
+    C.parallelize(j, s_dynamic);
+    C.unroll_and_jam(j, 4);
+    D.unroll_and_jam(l, 8);
+
+    tiramisu::codegen({A.get_buffer(), B.get_buffer(), C.get_buffer(), D.get_buffer()},
+                      "build/generated_fct_test_185.o");
+
+    // The jammed and the remainder loops of C are both scheduled, and D is
+    // unrolled and jammed (into an empty loop).
+    tiramisu::function *fct = global::get_implicit_function();
+    if ((count_in_halide_stmt(fct, "_jam_chunk") == 0) || (count_in_halide_stmt(fct, "parallel (") != 2) ||
+        (count_in_halide_stmt(fct, "_jam, 0, ") == 0))
+    {
+        std::cerr << "The loops were not unrolled and jammed as expected." << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    return gen("func", 30, 3);
+}
@@ -0,0 +1,76 @@
+#include <tiramisu/tiramisu.h>
+
+#include <iostream>
+#include <regex>
+#include <sstream>
+
+using namespace tiramisu;
+
+// Return the number of matches of \p pattern in the Halide statement
+// generated for the function \p fct.
+int count_in_halide_stmt(tiramisu::function *fct, const std::string &pattern)
+{
+    std::stringstream stmt;
+    std::streambuf *out = std::cout.rdbuf(stmt.rdbuf());
+    fct->dump_halide_stmt();
+    std::cout.rdbuf(out);
+
+    std::string s = stmt.str();
+    std::regex re(pattern);
+    return std::distance(std::sregex_iterator(s.begin(), s.end(), re), std::sregex_iterator());
+}
+
+int gen(std::string name, int size)
+{
+    tiramisu::init(name);
+
+    tiramisu::var i("i", 0, size), j("j", 0, size), k("k", 0, size), z("z", 0, 1);
+
+    tiramisu::input A("A", {i, k}, p_int32);
+    tiramisu::input B("B", {k, j}, p_int32);
+    tiramisu::input S("S", {z}, p_int32);
+
+    // C = A * B, with the j loop unrolled and jammed into the k loop: the
+    // four accumulators C(i, 4*j1 + 0..3) are promoted to four registers.
+    tiramisu::computation C_init({i, j}, tiramisu::expr((int32_t) 0));
+    tiramisu::computation C({i, j, k}, p_int32);
+    C.set_expression(C(i, j, 0) + A(i, k) * B(k, j));
+    tiramisu::buffer b_C("b_C", {size, size}, p_int32, a_output);
+    C.store_in(&b_C, {i, j});
+    C_init.store_in(&b_C, {i, j});
+
+    // D(i) = sum_k A(i, k) * S(0).  S(0) is invariant in the parallel loop
+    // i and is promoted there.
+    tiramisu::computation D_init({i}, tiramisu::expr((int32_t) 0));
+    tiramisu::computation D({i, k}, p_int32);
+    D.set_expression(D(i, 0) + A(i, k) * S(0));
+    tiramisu::buffer b_D("b_D", {size}, p_int32, a_output);
+    D.store_in(&b_D, {i});
+    D_init.store_in(&b_D, {i});
+
+    C.after(C_init, computation::root);
+    D_init.after(C, computation::root);
+    D.after(D_init, computation::root);
+
+    C.unroll_and_jam(j, 4);
+    D.parallelize(i, s_dynamic);
+    D.promote_to_register(i);
+
+    tiramisu::codegen({A.get_buffer(), B.get_buffer(), S.get_buffer(), &b_C, &b_D},
+                      "build/generated_fct_test_186.o");
+
+    tiramisu::function *fct = global::get_implicit_function();
+    if ((count_in_halide_stmt(fct, "allocate b_C_reg_") != 4) || (count_in_halide_stmt(fct, "allocate \\S*_reg_") != 5) ||
+        (count_in_halide_stmt(fct, "parallel \\(") != 1))
+    {
+        std::cerr << "The accesses were not promoted to registers as expected." << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    return gen("func", 30);
+}
@@ -0,0 +1,28 @@
+#include <tiramisu/tiramisu.h>
+
+using namespace tiramisu;
+
+void gen(std::string name, int rows, int cols)
+{
+    tiramisu::init(name);
+
+    tiramisu::var i("i", 0, rows), j("j", 0, cols);
+
+    tiramisu::input A("A", {i, j}, p_int32);
+
+    // The extent of j is not a multiple of the vector length: the last
+    // vector of each row is masked instead of being executed by a scalar
+    // epilogue.
+    tiramisu::computation B({i, j}, A(i, j) * 3 + 1);
+    B.store_in({i, j}, {rows, cols});
+    B.vectorize(j, 8, v_masked);
+
+    tiramisu::codegen({A.get_buffer(), B.get_buffer()}, "build/generated_fct_test_187.o");
+}
+
+int main(int argc, char **argv)
+{
+    gen("func", 10, 21);
+
+    return 0;
+}
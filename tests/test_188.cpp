@@ -0,0 +1,59 @@
+#include <tiramisu/debug.h>
+#include <tiramisu/core.h>
+
+#include <Halide.h>
+
+using namespace tiramisu;
+
+// Exchange column halos between 10 ranks using strided transfers. Each rank sends its last 16 columns to the
+// next rank (large blocks, sent with an MPI vector datatype) and its column 20 to the previous rank (single
+// elements, packed).
+
+void generate_function_1(std::string name) {
+    global::set_default_tiramisu_options();
+
+    function function0(std::move(name));
+
+    var x("x"), y("y"), q("q");
+    computation input("{input[x,y]: 0<=x<100 and 0<=y<100}", expr(), false, p_int32, &function0);
+
+    xfer fwd = computation::create_xfer("{fwd_send[q,x,y]: 0<=q<9 and 0<=x<100 and 84<=y<100}",
+                                        "{fwd_recv[q,x,y]: 1<=q<10 and 0<=x<100 and 0<=y<16}",
+                                        q+1, q-1, xfer_prop(p_int32, {MPI, BLOCK, ASYNC}),
+                                        xfer_prop(p_int32, {MPI, BLOCK, ASYNC}), input(x,y), &function0);
+
+    xfer bwd = computation::create_xfer("{bwd_send[q,x]: 1<=q<10 and 0<=x<100}",
+                                        "{bwd_recv[q,x]: 0<=q<9 and 0<=x<100}",
+                                        q-1, q+1, xfer_prop(p_int32, {MPI, BLOCK, ASYNC}),
+                                        xfer_prop(p_int32, {MPI, BLOCK, ASYNC}), input(x,20), &function0);
+
+    // Each row of the halo is a contiguous block, the rows are 100 elements apart.
+    fwd.s->collapse_many({collapse_group(2, 84, -1, 16)});
+    fwd.r->collapse_many({collapse_group(2, 0, -1, 16)});
+    fwd.s->collapse_strided(1, 0, 100, 100);
+    fwd.r->collapse_strided(1, 0, 100, 100);
+    bwd.s->collapse_strided(1, 0, 100, 100);
+    bwd.r->collapse_strided(1, 0, 100, 100);
+
+    fwd.s->tag_distribute_level(q);
+    fwd.r->tag_distribute_level(q);
+    bwd.s->tag_distribute_level(q);
+    bwd.r->tag_distribute_level(q);
+
+    fwd.s->before(*fwd.r, computation::root);
+    fwd.r->before(*bwd.s, computation::root);
+    bwd.s->before(*bwd.r, computation::root);
+
+    buffer buff("buff", {100, 100}, p_int32, a_output, &function0);
+
+    input.set_access("{input[x,y]->buff[x,y]}");
+    fwd.r->set_access("{fwd_recv[q,x,y]->buff[x,y]}");
+    bwd.r->set_access("{bwd_recv[q,x]->buff[x,40]}");
+
+    function0.codegen({&buff}, "build/generated_fct_test_188.o");
+}
+
+int main() {
+    generate_function_1("dist_strided_halo");
+    return 0;
+}
@@ -0,0 +1,41 @@
+#include <tiramisu/debug.h>
+#include <tiramisu/core.h>
+
+#include <Halide.h>
+
+using namespace tiramisu;
+
+// Each of the 10 ranks contributes 4 values. Sum them across the ranks with an allreduce, and gather them
+// on all the ranks with a nonblocking allgather.
+
+void generate_function_1(std::string name) {
+    global::set_default_tiramisu_options();
+
+    function function0(std::move(name));
+
+    var i("i");
+    computation part("{part[i]: 0<=i<4}", expr(), false, p_int32, &function0);
+
+    collective total("{total[0]}", ALLREDUCE, REDUCE_SUM, part(0), 4,
+                     xfer_prop(p_int32, {MPI, BLOCK}), &function0);
+    collective gathered("{gathered[0]}", ALLGATHER, part(0), 4, 0,
+                        xfer_prop(p_int32, {MPI, NONBLOCK}), &function0);
+
+    total.before(gathered, computation::root);
+    gathered.before(gathered.get_wait(), computation::root);
+
+    buffer b_part("b_part", {4}, p_int32, a_input, &function0);
+    buffer b_total("b_total", {4}, p_int32, a_output, &function0);
+    buffer b_gathered("b_gathered", {40}, p_int32, a_output, &function0);
+
+    part.set_access("{part[i]->b_part[i]}");
+    total.set_access("{total[i]->b_total[i]}");
+    gathered.set_access("{gathered[i]->b_gathered[i]}");
+
+    function0.codegen({&b_part, &b_total, &b_gathered}, "build/generated_fct_test_190.o");
+}
+
+int main() {
+    generate_function_1("dist_collectives");
+    return 0;
+}
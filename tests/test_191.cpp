@@ -0,0 +1,44 @@
+#include <tiramisu/debug.h>
+#include <tiramisu/core.h>
+
+#include <Halide.h>
+
+using namespace tiramisu;
+
+// Exchange row halos between 10 ranks with one-sided transfers. Each rank puts its row 8 into the row 0 of the
+// next rank, and gets the row 1 of the next rank into its row 9.
+
+void generate_function_1(std::string name) {
+    global::set_default_tiramisu_options();
+
+    function function0(std::move(name));
+
+    var y("y"), q("q");
+    computation input("{input[x,y]: 0<=x<10 and 0<=y<10}", expr(), false, p_int32, &function0);
+
+    xfer put = computation::create_xfer("{halo_put[q,y]: 0<=q<9 and 0<=y<10}", q+1,
+                                        xfer_prop(p_int32, {MPI, RMA_PUT}), input(8,y), &function0);
+    xfer get = computation::create_xfer("{halo_get[q,y]: 0<=q<9 and 0<=y<10}", q+1,
+                                        xfer_prop(p_int32, {MPI, RMA_GET}), input(1,y), &function0);
+
+    put.sr->collapse_many({collapse_group(1, 0, -1, 10)});
+    get.sr->collapse_many({collapse_group(1, 0, -1, 10)});
+
+    put.sr->tag_distribute_level(q);
+    get.sr->tag_distribute_level(q);
+
+    put.sr->before(*get.sr, computation::root);
+
+    buffer buff("buff", {10, 10}, p_int32, a_output, &function0);
+
+    input.set_access("{input[x,y]->buff[x,y]}");
+    put.sr->set_access("{halo_put[q,y]->buff[0,y]}");
+    get.sr->set_access("{halo_get[q,y]->buff[9,y]}");
+
+    function0.codegen({&buff}, "build/generated_fct_test_191.o");
+}
+
+int main() {
+    generate_function_1("dist_rma_halo");
+    return 0;
+}
@@ -0,0 +1,38 @@
+#include <tiramisu/debug.h>
+#include <tiramisu/core.h>
+
+#include <Halide.h>
+
+using namespace tiramisu;
+
+// A 1D stencil distributed block-cyclically over 10 ranks (blocks of 4 iterations, each rank owning 2 blocks).
+// The buffers have the same layout on every rank, and gen_communication() receives the element that follows each
+// block of a rank from the rank that owns it.
+
+void generate_function_1(std::string name) {
+    global::set_default_tiramisu_options();
+
+    function function0(std::move(name));
+
+    var i("i");
+    computation in("{in[i]: 0<=i<80}", expr(), false, p_int32, &function0);
+    computation blur("{blur[i]: 0<=i<79}", in(i) + in(i+1), true, p_int32, &function0);
+
+    in.tag_distribute_level(i, d_block_cyclic, 10, 4);
+    blur.tag_distribute_level(i, d_block_cyclic, 10, 4);
+
+    buffer b_in("b_in", {80}, p_int32, a_input, &function0);
+    buffer b_blur("b_blur", {79}, p_int32, a_output, &function0);
+
+    in.set_access("{in[i]->b_in[i]}");
+    blur.set_access("{blur[i]->b_blur[i]}");
+
+    blur.gen_communication();
+
+    function0.codegen({&b_in, &b_blur}, "build/generated_fct_test_193.o");
+}
+
+int main() {
+    generate_function_1("dist_block_cyclic_blur");
+    return 0;
+}
@@ -0,0 +1,40 @@
+#include <tiramisu/debug.h>
+#include <tiramisu/core.h>
+
+#include <Halide.h>
+
+using namespace tiramisu;
+
+// A 1D stencil distributed by blocks over 10 ranks. The inputs are only initialized on the rank 0:
+// gen_data_distribution() sends to each rank the elements of A and B that it reads, and gathers C
+// on the rank 0.
+
+void generate_function_1(std::string name) {
+    global::set_default_tiramisu_options();
+
+    function function0(std::move(name));
+
+    var i("i");
+    computation A("{A[i]: 0<=i<41}", expr(), false, p_int32, &function0);
+    computation B("{B[i]: 0<=i<40}", expr(), false, p_int32, &function0);
+    computation C("{C[i]: 0<=i<40}", A(i) + A(i+1) + B(i), true, p_int32, &function0);
+
+    C.tag_distribute_level(i, d_block, 10);
+
+    buffer b_A("b_A", {41}, p_int32, a_input, &function0);
+    buffer b_B("b_B", {40}, p_int32, a_input, &function0);
+    buffer b_C("b_C", {40}, p_int32, a_output, &function0);
+
+    A.set_access("{A[i]->b_A[i]}");
+    B.set_access("{B[i]->b_B[i]}");
+    C.set_access("{C[i]->b_C[i]}");
+
+    function0.gen_data_distribution();
+
+    function0.codegen({&b_A, &b_B, &b_C}, "build/generated_fct_test_194.o");
+}
+
+int main() {
+    generate_function_1("dist_inferred_stencil");
+    return 0;
+}
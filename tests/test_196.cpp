@@ -0,0 +1,36 @@
+#include <tiramisu/tiramisu.h>
+
+using namespace tiramisu;
+
+void gen(std::string name, int rows, int cols)
+{
+    tiramisu::init(name);
+
+    tiramisu::var i("i", 0, rows), j("j", 0, cols);
+
+    tiramisu::input A("A", {i, j}, p_int32);
+
+    // B writes the whole output with non-temporal stores, then C
+    // overwrites its first column with regular stores.
+    tiramisu::computation B({i, j}, A(i, j) * 2);
+    tiramisu::computation C({i}, A(i, 0) + 100);
+
+    tiramisu::buffer b_out("b_out", {rows, cols}, p_int32, a_output);
+    B.store_in(&b_out, {i, j});
+    C.store_in(&b_out, {i, 0});
+
+    C.after(B, computation::root);
+
+    B.parallelize(i);
+    B.vectorize(j, 8);
+    B.tag_nontemporal_store();
+
+    tiramisu::codegen({A.get_buffer(), &b_out}, "build/generated_fct_test_196.o");
+}
+
+int main(int argc, char **argv)
+{
+    gen("func", 64, 256);
+
+    return 0;
+}
@@ -0,0 +1,39 @@
+#include <tiramisu/tiramisu.h>
+
+using namespace tiramisu;
+
+void gen(std::string name, int rows, int cols)
+{
+    tiramisu::init(name);
+
+    tiramisu::var i("i", 0, rows), j("j", 0, cols);
+    tiramisu::var ib("ib", 0, rows + 2), ii("ii", 0, rows + 2);
+
+    tiramisu::input A("A", {ii, j}, p_int32);
+
+    tiramisu::computation T({ib, j}, A(ib, j) * 3);
+    tiramisu::computation B({i, j}, T(i, j) + T(i + 1, j) + T(i + 2, j));
+
+    B.after(T, computation::root);
+    T.parallelize(ib);
+    B.parallelize(i);
+
+    // The temporary is larger than a huge page and its rows are not a
+    // multiple of the page size.
+    tiramisu::buffer b_T("b_T", {rows + 2, cols}, p_int32, a_temporary);
+    b_T.set_numa_first_touch(true);
+    b_T.set_huge_pages(true);
+    T.store_in(&b_T);
+
+    tiramisu::buffer b_B("b_B", {rows, cols}, p_int32, a_output);
+    B.store_in(&b_B);
+
+    tiramisu::codegen({A.get_buffer(), &b_B}, "build/generated_fct_test_197.o");
+}
+
+int main(int argc, char **argv)
+{
+    gen("func", 600, 1000);
+
+    return 0;
+}
@@ -0,0 +1,72 @@
+#include <tiramisu/tiramisu.h>
+
+#include <iostream>
+#include <regex>
+#include <sstream>
+
+using namespace tiramisu;
+
+// Return the number of matches of \p pattern in the Halide statement
+// generated for the function \p fct.
+int count_in_halide_stmt(tiramisu::function *fct, const std::string &pattern)
+{
+    std::stringstream stmt;
+    std::streambuf *out = std::cout.rdbuf(stmt.rdbuf());
+    fct->dump_halide_stmt();
+    std::cout.rdbuf(out);
+
+    std::string s = stmt.str();
+    std::regex re(pattern);
+    return std::distance(std::sregex_iterator(s.begin(), s.end(), re), std::sregex_iterator());
+}
+
+int gen(std::string name, int size)
+{
+    tiramisu::init(name);
+
+    tiramisu::var i("i", 0, size), j("j", 0, size), k("k", 0, size), i2("i2", 0, size - 1);
+
+    tiramisu::input A("A", {i, k}, p_int32);
+    tiramisu::input I("I", {i, j}, p_int32);
+
+    // C(i, j) and C(j, i) are both invariant in the k loop, but they are
+    // the same element on the diagonal: C cannot be promoted.
+    tiramisu::computation C_init({i, j}, I(i, j));
+    tiramisu::computation C({i, j, k}, p_int32);
+    C.set_expression(C(i, j, 0) + C(j, i, 0) * A(i, k));
+    tiramisu::buffer b_C("b_C", {size, size}, p_int32, a_output);
+    C.store_in(&b_C, {i, j});
+    C_init.store_in(&b_C, {i, j});
+
+    // E(i2) and E(i2 + 1) are distinct elements: E is promoted to two
+    // registers.
+    tiramisu::computation E_init({i}, I(i, 0));
+    tiramisu::computation E({i2, k}, p_int32);
+    E.set_expression(E(i2, 0) + E(i2 + 1, 0) * A(i2, k));
+    tiramisu::buffer b_E("b_E", {size}, p_int32, a_output);
+    E.store_in(&b_E, {i2});
+    E_init.store_in(&b_E, {i});
+
+    C.after(C_init, computation::root);
+    E_init.after(C, computation::root);
+    E.after(E_init, computation::root);
+
+    C.promote_to_register(k);
+    E.promote_to_register(k);
+
+    tiramisu::codegen({A.get_buffer(), I.get_buffer(), &b_C, &b_E}, "build/generated_fct_test_198.o");
+
+    tiramisu::function *fct = global::get_implicit_function();
+    if ((count_in_halide_stmt(fct, "allocate b_C_reg_") != 0) || (count_in_halide_stmt(fct, "allocate b_E_reg_") != 2))
+    {
+        std::cerr << "The aliased accesses were promoted to registers." << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    return gen("func", 8);
+}
@@ -0,0 +1,40 @@
+#include <tiramisu/tiramisu.h>
+
+using namespace tiramisu;
+
+int gen(std::string name, int rows, int cols, int v)
+{
+    tiramisu::init(name);
+
+    tiramisu::var i("i", 0, rows), j("j", 0, cols);
+
+    tiramisu::input A("A", {i, j}, p_int32);
+
+    // The extent of j is not a multiple of the vector length: the last
+    // vector of each row runs past the end of the row, into the padding
+    // added to the temporary T and to the arguments A and B.
+    tiramisu::computation T({i, j}, A(i, j) * 3);
+    T.store_in({i, j}, {rows, cols});
+    T.vectorize(j, v, v_padded);
+
+    tiramisu::computation B({i, j}, T(i, j) + 1);
+    B.store_in({i, j}, {rows, cols});
+    B.vectorize(j, v, v_padded);
+    B.after(T, computation::root);
+
+    global::get_implicit_function()->set_automatic_buffer_padding(true, true);
+
+    tiramisu::codegen({A.get_buffer(), B.get_buffer()}, "build/generated_fct_test_199.o");
+
+    for (tiramisu::buffer *buf : {A.get_buffer(), T.get_buffer(), B.get_buffer()})
+        if ((buf->get_dim_sizes()[0].get_int_val() != rows) ||
+            (buf->get_dim_sizes()[1].get_int_val() != cols + v - 1))
+            return 1;
+
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    return gen("func", 10, 21, 8);
+}
@@ -0,0 +1,76 @@
+#include <tiramisu/debug.h>
+#include <tiramisu/core.h>
+
+#include <Halide.h>
+
+#include <iostream>
+#include <regex>
+#include <sstream>
+
+using namespace tiramisu;
+
+// A time loop of halo exchanges between 10 ranks, with persistent requests. In each time step, each rank sends
+// its element 1 to the previous rank, which receives it in its element 9, and then adds element 9 to element 1.
+// The transfers always access the same elements, so they are initialized once before the time loop.
+
+// Return the number of matches of \p pattern in the Halide statement
+// generated for the function \p fct.
+int count_in_halide_stmt(tiramisu::function *fct, const std::string &pattern)
+{
+    std::stringstream stmt;
+    std::streambuf *out = std::cout.rdbuf(stmt.rdbuf());
+    fct->dump_halide_stmt();
+    std::cout.rdbuf(out);
+
+    std::string s = stmt.str();
+    std::regex re(pattern);
+    return std::distance(std::sregex_iterator(s.begin(), s.end(), re), std::sregex_iterator());
+}
+
+int generate_function_1(std::string name) {
+    global::set_default_tiramisu_options();
+
+    function function0(std::move(name));
+
+    var q("q"), t("t");
+    computation field("{field[x]: 0<=x<10}", expr(), false, p_int32, &function0);
+
+    xfer halo = computation::create_xfer("{halo_send[q,t]: 1<=q<10 and 0<=t<5}",
+                                         "{halo_recv[q,t]: 0<=q<9 and 0<=t<5}",
+                                         q-1, q+1, xfer_prop(p_int32, {MPI, BLOCK, ASYNC}),
+                                         xfer_prop(p_int32, {MPI, BLOCK, ASYNC}), field(1), &function0);
+
+    computation step("{step[q,t]: 0<=q<10 and 0<=t<5}", field(1) + field(9), true, p_int32, &function0);
+
+    halo.s->tag_distribute_level(q);
+    halo.r->tag_distribute_level(q);
+    step.tag_distribute_level(q);
+
+    halo.s->before(*halo.r, t);
+    halo.r->before(step, t);
+
+    buffer buff("buff", {10}, p_int32, a_output, &function0);
+
+    field.set_access("{field[x]->buff[x]}");
+    halo.r->set_access("{halo_recv[q,t]->buff[9]}");
+    step.set_access("{step[q,t]->buff[1]}");
+
+    function0.set_persistent_communication(true);
+    function0.codegen({&buff}, "build/generated_fct_test_201.o");
+
+    if ((count_in_halide_stmt(&function0, "tiramisu_MPI_Send_init_int32\\(") != 1) ||
+        (count_in_halide_stmt(&function0, "tiramisu_MPI_Recv_init_int32\\(") != 1) ||
+        (count_in_halide_stmt(&function0, "tiramisu_MPI_Startall\\(") != 1) ||
+        (count_in_halide_stmt(&function0, "tiramisu_MPI_Send_int32\\(") != 0) ||
+        (count_in_halide_stmt(&function0, "tiramisu_MPI_Recv_int32\\(") != 0))
+    {
+        std::cerr << "The halo exchanges do not use persistent requests." << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
+
+int main() {
+    return generate_function_1("dist_persistent_halo");
+}
@@ -0,0 +1,71 @@
+#include <tiramisu/tiramisu.h>
+
+#include <iostream>
+#include <sstream>
+
+using namespace tiramisu;
+
+// Return the number of lines of the Halide statement generated for the
+// function \p fct that contain both \p store and \p marker.
+int count_stores(tiramisu::function *fct, const std::string &store, const std::string &marker)
+{
+    std::stringstream stmt;
+    std::streambuf *out = std::cout.rdbuf(stmt.rdbuf());
+    fct->dump_halide_stmt();
+    std::cout.rdbuf(out);
+
+    int count = 0;
+    std::string line;
+    while (std::getline(stmt, line))
+        if ((line.find(store) != std::string::npos) && (line.find(marker) != std::string::npos))
+            count++;
+    return count;
+}
+
+int gen(std::string name, int rows, int cols)
+{
+    tiramisu::init(name);
+
+    tiramisu::var i("i", 0, rows), j("j", 0, cols);
+
+    tiramisu::input A("A", {i, j}, p_int32);
+
+    // B and C are fused in the same loop and write the even and the odd
+    // columns of b_out: only the stores of B are non-temporal.  D, fused
+    // in the same loop too, writes a second buffer with non-temporal
+    // stores.
+    tiramisu::computation B({i, j}, A(i, j) * 2);
+    tiramisu::computation C({i, j}, A(i, j) + 100);
+    tiramisu::computation D({i, j}, A(i, j) - 1);
+
+    tiramisu::buffer b_out("b_out", {rows, 2 * cols}, p_int32, a_output);
+    tiramisu::buffer b_out2("b_out2", {rows, cols}, p_int32, a_output);
+    B.store_in(&b_out, {i, 2 * j});
+    C.store_in(&b_out, {i, 2 * j + 1});
+    D.store_in(&b_out2, {i, j});
+
+    C.after(B, j);
+    D.after(C, j);
+
+    B.parallelize(i);
+    B.tag_nontemporal_store();
+    D.tag_nontemporal_store();
+
+    tiramisu::codegen({A.get_buffer(), &b_out, &b_out2}, "build/generated_fct_test_202.o");
+
+    tiramisu::function *fct = global::get_implicit_function();
+    if ((count_stores(fct, "b_out[", "") != 2) ||
+        (count_stores(fct, "b_out[", nontemporal_store_marker()) != 1) ||
+        (count_stores(fct, "b_out2[", nontemporal_store_marker()) != 1))
+    {
+        std::cerr << "The non-temporal stores are not the stores of the tagged computations." << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    return gen("func", 64, 128);
+}
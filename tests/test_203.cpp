@@ -0,0 +1,90 @@
+#include <tiramisu/debug.h>
+#include <tiramisu/core.h>
+
+#include <Halide.h>
+
+#include <iostream>
+#include <regex>
+#include <sstream>
+
+using namespace tiramisu;
+
+// Each of the 10 ranks sends a 4x8 block to the next rank, one element per nonblocking transfer, in each of the 3
+// iterations of a time loop, and computes a 16x16 block before waiting on the transfers. Each iteration of the
+// computation tests the pending requests with tiramisu_MPI_Testsome, and the remaining requests are then waited on
+// with tiramisu_MPI_Waitall.
+
+// Return the number of matches of \p pattern in the Halide statement
+// generated for the function \p fct.
+int count_in_halide_stmt(tiramisu::function *fct, const std::string &pattern)
+{
+    std::stringstream stmt;
+    std::streambuf *out = std::cout.rdbuf(stmt.rdbuf());
+    fct->dump_halide_stmt();
+    std::cout.rdbuf(out);
+
+    std::string s = stmt.str();
+    std::regex re(pattern);
+    return std::distance(std::sregex_iterator(s.begin(), s.end(), re), std::sregex_iterator());
+}
+
+int generate_function_1(std::string name) {
+    global::set_default_tiramisu_options();
+
+    function function0(std::move(name));
+
+    var x("x"), y("y"), q("q"), t("t"), i("i"), j("j");
+    computation input("{input[x,y]: 0<=x<4 and 0<=y<8}", expr(), false, p_int32, &function0);
+
+    xfer sr = computation::create_xfer("{send[q,t,x,y]: 0<=q<9 and 0<=t<3 and 0<=x<4 and 0<=y<8}",
+                                       "{recv[q,t,x,y]: 1<=q<10 and 0<=t<3 and 0<=x<4 and 0<=y<8}",
+                                       q+1, q-1, xfer_prop(p_int32, {MPI, NONBLOCK, ASYNC}),
+                                       xfer_prop(p_int32, {MPI, NONBLOCK, ASYNC}), input(x,y), &function0);
+
+    computation comp("{comp[q,t,i,j]: 0<=q<10 and 0<=t<3 and 0<=i<16 and 0<=j<16}", t + i * 16 + j, true, p_int32,
+                     &function0);
+
+    tiramisu::wait wait_send(sr.s->operator()(0,0,x,y), xfer_prop(p_wait_ptr, {MPI}), &function0);
+    tiramisu::wait wait_recv(sr.r->operator()(0,0,x,y), xfer_prop(p_wait_ptr, {MPI}), &function0);
+
+    sr.s->tag_distribute_level(q);
+    sr.r->tag_distribute_level(q);
+    comp.tag_distribute_level(q);
+    wait_send.tag_distribute_level(q);
+    wait_recv.tag_distribute_level(q);
+
+    // The computation runs while the transfers of a time step are in flight.
+    sr.s->before(*sr.r, t);
+    sr.r->before(comp, t);
+    comp.before(wait_send, t);
+    wait_send.before(wait_recv, t);
+
+    buffer buff_in("buff_in", {4, 8}, p_int32, a_input, &function0);
+    buffer buff_out("buff_out", {3, 4, 8}, p_int32, a_output, &function0);
+    buffer buff_comp("buff_comp", {3, 16, 16}, p_int32, a_output, &function0);
+    buffer buff_wait_send("buff_wait_send", {4, 8}, p_wait_ptr, a_temporary, &function0);
+    buffer buff_wait_recv("buff_wait_recv", {4, 8}, p_wait_ptr, a_temporary, &function0);
+
+    input.set_access("{input[x,y]->buff_in[x,y]}");
+    sr.r->set_access("{recv[q,t,x,y]->buff_out[t,x,y]}");
+    comp.set_access("{comp[q,t,i,j]->buff_comp[t,i,j]}");
+
+    sr.s->set_wait_access("{send[q,t,x,y]->buff_wait_send[x,y]}");
+    sr.r->set_wait_access("{recv[q,t,x,y]->buff_wait_recv[x,y]}");
+
+    function0.codegen({&buff_in, &buff_out, &buff_comp}, "build/generated_fct_test_203.o");
+
+    // The requests of both waits are tested in the computation loop.
+    if ((count_in_halide_stmt(&function0, "tiramisu_MPI_Testsome\\(") != 2) ||
+        (count_in_halide_stmt(&function0, "tiramisu_MPI_Waitall\\(") != 2))
+    {
+        std::cerr << "The pending requests were not tested during the computation." << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
+
+int main() {
+    return generate_function_1("dist_nonblock_progress");
+}
@@ -0,0 +1,84 @@
+#include <tiramisu/debug.h>
+#include <tiramisu/core.h>
+
+#include <Halide.h>
+
+#include <iostream>
+#include <regex>
+#include <sstream>
+
+using namespace tiramisu;
+
+// Same halo exchange as test 192, but the exchanged buffer is a temporary buffer that the generated code allocates
+// in memory shared by the ranks of the node (buffer::set_node_shared()). Each rank initializes its buffer, puts its
+// row 8 into the row 0 of the next rank, gets the row 1 of the next rank into its row 9, and copies the buffer to
+// its output.
+
+// Return the number of matches of \p pattern in the Halide statement
+// generated for the function \p fct.
+int count_in_halide_stmt(tiramisu::function *fct, const std::string &pattern)
+{
+    std::stringstream stmt;
+    std::streambuf *out = std::cout.rdbuf(stmt.rdbuf());
+    fct->dump_halide_stmt();
+    std::cout.rdbuf(out);
+
+    std::string s = stmt.str();
+    std::regex re(pattern);
+    return std::distance(std::sregex_iterator(s.begin(), s.end(), re), std::sregex_iterator());
+}
+
+int generate_function_1(std::string name) {
+    global::set_default_tiramisu_options();
+
+    function function0(std::move(name));
+
+    var x("x"), y("y"), q("q");
+    computation init("{init[q,x,y]: 0<=q<10 and 0<=x<10 and 0<=y<10}", q * 1000 + x * 10 + y, true, p_int32,
+                     &function0);
+    computation input("{input[x,y]: 0<=x<10 and 0<=y<10}", expr(), false, p_int32, &function0);
+
+    xfer put = computation::create_xfer("{halo_put[q,y]: 0<=q<9 and 0<=y<10}", q+1,
+                                        xfer_prop(p_int32, {MPI, RMA_PUT}), input(8,y), &function0);
+    xfer get = computation::create_xfer("{halo_get[q,y]: 0<=q<9 and 0<=y<10}", q+1,
+                                        xfer_prop(p_int32, {MPI, RMA_GET}), input(1,y), &function0);
+
+    computation copy("{copy[q,x,y]: 0<=q<10 and 0<=x<10 and 0<=y<10}", input(x,y), true, p_int32, &function0);
+
+    put.sr->collapse_many({collapse_group(1, 0, -1, 10)});
+    get.sr->collapse_many({collapse_group(1, 0, -1, 10)});
+
+    init.tag_distribute_level(q);
+    put.sr->tag_distribute_level(q);
+    get.sr->tag_distribute_level(q);
+    copy.tag_distribute_level(q);
+
+    init.before(*put.sr, computation::root);
+    put.sr->before(*get.sr, computation::root);
+    get.sr->before(copy, computation::root);
+
+    buffer buff("buff", {10, 10}, p_int32, a_temporary, &function0);
+    buffer buff_out("buff_out", {10, 10}, p_int32, a_output, &function0);
+    buff.set_node_shared(true);
+
+    init.set_access("{init[q,x,y]->buff[x,y]}");
+    input.set_access("{input[x,y]->buff[x,y]}");
+    put.sr->set_access("{halo_put[q,y]->buff[0,y]}");
+    get.sr->set_access("{halo_get[q,y]->buff[9,y]}");
+    copy.set_access("{copy[q,x,y]->buff_out[x,y]}");
+
+    function0.codegen({&buff_out}, "build/generated_fct_test_204.o");
+
+    if ((count_in_halide_stmt(&function0, "tiramisu_MPI_alloc_node_shared\\(") != 1) ||
+        (count_in_halide_stmt(&function0, "tiramisu_MPI_free_node_shared\\(") != 1))
+    {
+        std::cerr << "The temporary buffer was not allocated in node-shared memory." << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
+
+int main() {
+    return generate_function_1("dist_rma_node_shared_temporary");
+}
@@ -0,0 +1,27 @@
+#include "Halide.h"
+#include "wrapper_test_175.h"
+
+#include <tiramisu/utils.h>
+
+#define NN 256
+
+int main(int, char **)
+{
+    Halide::Buffer<float> input_buf(NN, NN);
+    Halide::Buffer<float> reference_buf(NN, NN);
+    Halide::Buffer<float> output_buf(NN, NN);
+
+    for (int i = 0; i < NN; i++)
+        for (int j = 0; j < NN; j++)
+        {
+            input_buf(j, i) = i + j;
+            reference_buf(j, i) = (i + j + 1) * 2;
+        }
+
+    init_buffer(output_buf, (float)0);
+
+    func(input_buf.raw_buffer(), output_buf.raw_buffer());
+    compare_buffers("automatic_buffer_padding", output_buf, reference_buf);
+
+    return 0;
+}
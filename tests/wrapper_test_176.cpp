@@ -0,0 +1,27 @@
+#include "Halide.h"
+#include "wrapper_test_176.h"
+
+#include <tiramisu/utils.h>
+
+#define NN 100
+
+int main(int, char **)
+{
+    Halide::Buffer<float> input_buf(NN, NN);
+    Halide::Buffer<float> reference_buf(NN, NN);
+    Halide::Buffer<float> output_buf(NN, NN);
+
+    for (int i = 0; i < NN; i++)
+        for (int j = 0; j < NN; j++)
+        {
+            input_buf(j, i) = i * NN + j;
+            reference_buf(i, j) = i * NN + j;
+        }
+
+    init_buffer(output_buf, (float)0);
+
+    func(input_buf.raw_buffer(), output_buf.raw_buffer());
+    compare_buffers("cache_local", output_buf, reference_buf);
+
+    return 0;
+}
@@ -0,0 +1,29 @@
+#include "Halide.h"
+#include "wrapper_test_177.h"
+
+#include <tiramisu/utils.h>
+
+#define NN 100
+
+int main(int, char **)
+{
+    Halide::Buffer<int32_t> input_buf(NN, NN);
+    Halide::Buffer<int32_t> b_buf(NN, NN);
+    Halide::Buffer<int32_t> reference_buf(NN, NN);
+    Halide::Buffer<int32_t> output_buf(NN, NN);
+
+    for (int i = 0; i < NN; i++)
+        for (int j = 0; j < NN; j++)
+        {
+            input_buf(j, i) = i * NN + j;
+            reference_buf(j, i) = (i * NN + j + 1) * 2;
+        }
+
+    init_buffer(b_buf, (int32_t)0);
+    init_buffer(output_buf, (int32_t)0);
+
+    func(input_buf.raw_buffer(), b_buf.raw_buffer(), output_buf.raw_buffer());
+    compare_buffers("prefetch", output_buf, reference_buf);
+
+    return 0;
+}
@@ -0,0 +1,30 @@
+#include "Halide.h"
+#include "wrapper_test_178.h"
+
+#include <tiramisu/utils.h>
+
+#define NN 100
+
+int main(int, char **)
+{
+    Halide::Buffer<int32_t> input_buf(NN, NN);
+    Halide::Buffer<int32_t> reference_buf(NN);
+    Halide::Buffer<int32_t> output_buf(NN);
+
+    for (int i = 0; i < NN; i++)
+    {
+        reference_buf(i) = 0;
+        for (int j = 0; j < NN; j++)
+        {
+            input_buf(j, i) = i + j;
+            reference_buf(i) += i + j;
+        }
+    }
+
+    init_buffer(output_buf, (int32_t)0);
+
+    func(input_buf.raw_buffer(), output_buf.raw_buffer());
+    compare_buffers("rfactor", output_buf, reference_buf);
+
+    return 0;
+}
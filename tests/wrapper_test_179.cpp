@@ -0,0 +1,31 @@
+#include "Halide.h"
+#include "wrapper_test_179.h"
+
+#include <tiramisu/utils.h>
+
+#define NN 1000
+#define BINS 16
+
+int main(int, char **)
+{
+    Halide::Buffer<int32_t> input_buf(NN);
+    Halide::Buffer<int32_t> reference_buf(BINS);
+    Halide::Buffer<int32_t> h_buf(BINS);
+    Halide::Buffer<int32_t> g_buf(BINS);
+
+    init_buffer(reference_buf, (int32_t)0);
+    for (int i = 0; i < NN; i++)
+    {
+        input_buf(i) = i % 7;
+        reference_buf(i % BINS) += i % 7;
+    }
+
+    init_buffer(h_buf, (int32_t)0);
+    init_buffer(g_buf, (int32_t)0);
+
+    func(input_buf.raw_buffer(), h_buf.raw_buffer(), g_buf.raw_buffer());
+    compare_buffers("atomic update", h_buf, reference_buf);
+    compare_buffers("privatized update", g_buf, reference_buf);
+
+    return 0;
+}
@@ -0,0 +1,39 @@
+#include "Halide.h"
+#include "wrapper_test_180.h"
+
+#include <tiramisu/utils.h>
+
+#define STEPS 20
+#define NN 50
+
+int main(int, char **)
+{
+    Halide::Buffer<float> a_buf(NN, STEPS);
+    Halide::Buffer<float> a_ref(NN, STEPS);
+    Halide::Buffer<float> b_buf(NN, NN, STEPS);
+    Halide::Buffer<float> b_ref(NN, NN, STEPS);
+
+    for (int t = 0; t < STEPS; t++)
+        for (int i = 0; i < NN; i++)
+        {
+            a_buf(i, t) = a_ref(i, t) = (t == 0 || i == 0 || i == NN - 1) ? (float) (i % 5) : 0.0f;
+            for (int j = 0; j < NN; j++)
+                b_buf(j, i, t) = b_ref(j, i, t) =
+                    (t == 0 || i == 0 || i == NN - 1 || j == 0 || j == NN - 1) ? (float) ((i + j) % 7) : 0.0f;
+        }
+
+    for (int t = 1; t < STEPS; t++)
+        for (int i = 1; i < NN - 1; i++)
+        {
+            a_ref(i, t) = (a_ref(i - 1, t - 1) + a_ref(i, t - 1) + a_ref(i + 1, t - 1)) * 0.25f;
+            for (int j = 1; j < NN - 1; j++)
+                b_ref(j, i, t) = (b_ref(j, i - 1, t - 1) + b_ref(j, i + 1, t - 1) + b_ref(j, i, t - 1) +
+                                  b_ref(j - 1, i, t - 1) + b_ref(j + 1, i, t - 1)) * 0.125f;
+        }
+
+    func(a_buf.raw_buffer(), b_buf.raw_buffer());
+    compare_buffers("time tiling 1D", a_buf, a_ref);
+    compare_buffers("time tiling 2D", b_buf, b_ref);
+
+    return 0;
+}
@@ -0,0 +1,36 @@
+#include "Halide.h"
+#include "wrapper_test_181.h"
+
+#include <tiramisu/utils.h>
+
+#define NN 100
+
+int main(int, char **)
+{
+    Halide::Buffer<float> a_buf(NN, NN);
+    Halide::Buffer<float> a_ref(NN, NN);
+    Halide::Buffer<float> b_buf(NN, NN);
+    Halide::Buffer<float> b_ref(NN, NN);
+
+    for (int i = 0; i < NN; i++)
+        for (int j = 0; j < NN; j++)
+        {
+            bool border = (i == 0 || j == 0 || j == NN - 1);
+            a_buf(j, i) = a_ref(j, i) = border ? (float) ((i + 2 * j) % 5) : 0.0f;
+            b_buf(j, i) = b_ref(j, i) = border ? (float) ((2 * i + j) % 7) : 0.0f;
+        }
+
+    for (int i = 1; i < NN; i++)
+    {
+        for (int j = 1; j < NN; j++)
+            a_ref(j, i) = (a_ref(j, i - 1) + a_ref(j - 1, i)) * 0.5f;
+        for (int j = 1; j < NN - 1; j++)
+            b_ref(j, i) = (b_ref(j + 1, i - 1) + b_ref(j - 1, i)) * 0.5f;
+    }
+
+    func(a_buf.raw_buffer(), b_buf.raw_buffer());
+    compare_buffers("wavefront", a_buf, a_ref);
+    compare_buffers("pipelined wavefront", b_buf, b_ref);
+
+    return 0;
+}
@@ -0,0 +1,35 @@
+#include "Halide.h"
+#include "wrapper_test_182.h"
+
+#include <tiramisu/utils.h>
+
+#define BATCH 1
+#define CHANNELS 3
+#define NN 40
+
+int main(int, char **)
+{
+    Halide::Buffer<int32_t> in_buf(NN, NN, CHANNELS, BATCH);
+    Halide::Buffer<int32_t> c_buf(NN, NN, CHANNELS, BATCH);
+    Halide::Buffer<int32_t> c_ref(NN, NN, CHANNELS, BATCH);
+
+    for (int n = 0; n < BATCH; n++)
+        for (int c = 0; c < CHANNELS; c++)
+            for (int y = 0; y < NN; y++)
+                for (int x = 0; x < NN; x++)
+                {
+                    in_buf(x, y, c, n) = (x + 3 * y + 7 * c) % 11;
+                    c_buf(x, y, c, n) = c_ref(x, y, c, n) = 0;
+                }
+
+    for (int n = 0; n < BATCH; n++)
+        for (int c = 0; c < CHANNELS; c++)
+            for (int y = 1; y < NN - 1; y++)
+                for (int x = 1; x < NN - 1; x++)
+                    c_ref(x, y, c, n) = in_buf(x, y - 1, c, n) + in_buf(x, y, c, n) + in_buf(x, y + 1, c, n);
+
+    func(in_buf.raw_buffer(), c_buf.raw_buffer());
+    compare_buffers("collapse", c_buf, c_ref);
+
+    return 0;
+}
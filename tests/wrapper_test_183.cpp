@@ -0,0 +1,29 @@
+#include "Halide.h"
+#include "wrapper_test_183.h"
+
+#include <tiramisu/utils.h>
+
+#define NN 101
+
+int main(int, char **)
+{
+    Halide::Buffer<int32_t> a_buf(NN, NN), a_ref(NN, NN);
+    Halide::Buffer<int32_t> b_buf(NN, NN), b_ref(NN, NN);
+    Halide::Buffer<int32_t> c_buf(NN, NN), c_ref(NN, NN);
+
+    for (int i = 0; i < NN; i++)
+        for (int j = 0; j < NN; j++)
+        {
+            a_buf(j, i) = b_buf(j, i) = c_buf(j, i) = -1;
+            a_ref(j, i) = (i == 0) ? -1 : i * 3 + j;
+            b_ref(j, i) = (i == 0) ? -1 : i * 5 - j;
+            c_ref(j, i) = (i == 0) ? -1 : i - j * 7;
+        }
+
+    func(a_buf.raw_buffer(), b_buf.raw_buffer(), c_buf.raw_buffer());
+    compare_buffers("static parallel schedule", a_buf, a_ref);
+    compare_buffers("dynamic parallel schedule", b_buf, b_ref);
+    compare_buffers("guided parallel schedule", c_buf, c_ref);
+
+    return 0;
+}
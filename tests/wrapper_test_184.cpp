@@ -0,0 +1,30 @@
+#include "Halide.h"
+#include "wrapper_test_184.h"
+
+#include <tiramisu/utils.h>
+
+#define NN 64
+
+int main(int, char **)
+{
+    Halide::Buffer<int32_t> in_buf(NN, NN), a_buf(NN, NN);
+    Halide::Buffer<int32_t> b1_buf(NN, NN), b1_ref(NN, NN);
+    Halide::Buffer<int32_t> b2_buf(NN, NN), b2_ref(NN, NN);
+    Halide::Buffer<int32_t> c_buf(NN, NN), c_ref(NN, NN);
+
+    for (int i = 0; i < NN; i++)
+        for (int j = 0; j < NN; j++)
+        {
+            in_buf(j, i) = (i * 7 + j) % 13;
+            b1_ref(j, i) = in_buf(j, i) * 2 + 1;
+            b2_ref(j, i) = in_buf(j, i) * 2 * 3;
+            c_ref(j, i) = b1_ref(j, i) - b2_ref(j, i);
+        }
+
+    func(in_buf.raw_buffer(), a_buf.raw_buffer(), b1_buf.raw_buffer(), b2_buf.raw_buffer(), c_buf.raw_buffer());
+    compare_buffers("task parallelism (B1)", b1_buf, b1_ref);
+    compare_buffers("task parallelism (B2)", b2_buf, b2_ref);
+    compare_buffers("task parallelism (C)", c_buf, c_ref);
+
+    return 0;
+}
@@ -0,0 +1,13 @@
+#ifndef HALIDE__generated_h
+#define HALIDE__generated_h
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+int func(halide_buffer_t *_p0_buffer, halide_buffer_t *_p1_buffer, halide_buffer_t *_p2_buffer, halide_buffer_t *_p3_buffer, halide_buffer_t *_p4_buffer);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+#endif
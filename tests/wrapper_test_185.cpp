@@ -0,0 +1,37 @@
+#include "Halide.h"
+#include "wrapper_test_185.h"
+
+#include <tiramisu/utils.h>
+
+#define NN 30
+#define SMALL 3
+
+int main(int, char **)
+{
+    Halide::Buffer<int32_t> a_buf(NN, NN), b_buf(NN, NN);
+    Halide::Buffer<int32_t> c_buf(NN, NN), c_ref(NN, NN);
+    Halide::Buffer<int32_t> d_buf(SMALL, NN), d_ref(SMALL, NN);
+
+    for (int i = 0; i < NN; i++)
+        for (int j = 0; j < NN; j++)
+        {
+            a_buf(j, i) = (i + 2 * j) % 7 - 3;
+            b_buf(j, i) = (3 * i + j) % 5 - 2;
+        }
+
+    for (int i = 0; i < NN; i++)
+        for (int j = 0; j < NN; j++)
+        {
+            c_ref(j, i) = 0;
+            for (int k = 0; k < NN; k++)
+                c_ref(j, i) += a_buf(k, i) * b_buf(j, k);
+            if (j < SMALL)
+                d_ref(j, i) = c_ref(j, i);
+        }
+
+    func(a_buf.raw_buffer(), b_buf.raw_buffer(), c_buf.raw_buffer(), d_buf.raw_buffer());
+    compare_buffers("unroll and jam of a parallel loop", c_buf, c_ref);
+    compare_buffers("unroll and jam with a factor larger than the extent", d_buf, d_ref);
+
+    return 0;
+}
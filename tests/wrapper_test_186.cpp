@@ -0,0 +1,40 @@
+#include "Halide.h"
+#include "wrapper_test_186.h"
+
+#include <tiramisu/utils.h>
+
+#define NN 30
+
+int main(int, char **)
+{
+    Halide::Buffer<int32_t> a_buf(NN, NN), b_buf(NN, NN), s_buf(1);
+    Halide::Buffer<int32_t> c_buf(NN, NN), c_ref(NN, NN);
+    Halide::Buffer<int32_t> d_buf(NN), d_ref(NN);
+
+    for (int i = 0; i < NN; i++)
+        for (int j = 0; j < NN; j++)
+        {
+            a_buf(j, i) = (i + 2 * j) % 7 - 3;
+            b_buf(j, i) = (3 * i + j) % 5 - 2;
+        }
+    s_buf(0) = 3;
+
+    for (int i = 0; i < NN; i++)
+    {
+        d_ref(i) = 0;
+        for (int j = 0; j < NN; j++)
+        {
+            c_ref(j, i) = 0;
+            for (int k = 0; k < NN; k++)
+                c_ref(j, i) += a_buf(k, i) * b_buf(j, k);
+        }
+        for (int k = 0; k < NN; k++)
+            d_ref(i) += a_buf(k, i) * s_buf(0);
+    }
+
+    func(a_buf.raw_buffer(), b_buf.raw_buffer(), s_buf.raw_buffer(), c_buf.raw_buffer(), d_buf.raw_buffer());
+    compare_buffers("register promotion of the jammed accumulators", c_buf, c_ref);
+    compare_buffers("register promotion in a parallel loop", d_buf, d_ref);
+
+    return 0;
+}
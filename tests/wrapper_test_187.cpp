@@ -0,0 +1,25 @@
+#include "Halide.h"
+#include "wrapper_test_187.h"
+
+#include <tiramisu/utils.h>
+
+#define ROWS 10
+#define COLS 21
+
+int main(int, char **)
+{
+    Halide::Buffer<int32_t> a_buf(COLS, ROWS);
+    Halide::Buffer<int32_t> b_buf(COLS, ROWS), b_ref(COLS, ROWS);
+
+    for (int i = 0; i < ROWS; i++)
+        for (int j = 0; j < COLS; j++)
+        {
+            a_buf(j, i) = (i * COLS + j) % 13 - 6;
+            b_ref(j, i) = a_buf(j, i) * 3 + 1;
+        }
+
+    func(a_buf.raw_buffer(), b_buf.raw_buffer());
+    compare_buffers("masked vector tail", b_buf, b_ref);
+
+    return 0;
+}
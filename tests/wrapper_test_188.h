@@ -0,0 +1,25 @@
+#ifndef TIRAMISU_WRAPPER_TEST_188_H
+#define TIRAMISU_WRAPPER_TEST_188_H
+
+// Define these values for each new test
+#define TEST_NAME_STR       "Distributed strided halo exchange"
+#define TEST_NUMBER_STR     "188"
+
+// --------------------------------------------------------
+// No need to modify anything in the following ------------
+// --------------------------------------------------------
+
+#include <tiramisu/utils.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+int dist_strided_halo(halide_buffer_t *);
+int dist_strided_halo_argv(void **args);
+
+extern const struct halide_filter_metadata_t halide_pipeline_aot_metadata;
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif //TIRAMISU_WRAPPER_TEST_188_H
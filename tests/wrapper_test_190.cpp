@@ -0,0 +1,41 @@
+#include "wrapper_test_190.h"
+#include "Halide.h"
+
+#include <tiramisu/utils.h>
+#include <tiramisu/mpi_comm.h>
+#include <cstdlib>
+#include <iostream>
+
+int main() {
+#ifdef WITH_MPI
+    int rank = tiramisu_MPI_init();
+
+    Halide::Buffer<int> part(4, "part");
+    Halide::Buffer<int> total(4, "total");
+    Halide::Buffer<int> gathered(40, "gathered");
+    Halide::Buffer<int> total_ref(4, "total_ref");
+    Halide::Buffer<int> gathered_ref(40, "gathered_ref");
+
+    for (int i = 0; i < 4; i++) {
+        part(i) = rank * 10 + i;
+        // sum of (r * 10 + i) over the 10 ranks
+        total_ref(i) = 450 + 10 * i;
+    }
+    for (int r = 0; r < 10; r++) {
+        for (int i = 0; i < 4; i++) {
+            gathered_ref(r * 4 + i) = r * 10 + i;
+        }
+    }
+    init_buffer(total, 0);
+    init_buffer(gathered, 0);
+
+    dist_collectives(part.raw_buffer(), total.raw_buffer(), gathered.raw_buffer());
+    MPI_Barrier(MPI_COMM_WORLD);
+    compare_buffers(std::string(TEST_NAME_STR) + " (allreduce)", total, total_ref);
+    compare_buffers(std::string(TEST_NAME_STR) + " (allgather)", gathered, gathered_ref);
+    MPI_Barrier(MPI_COMM_WORLD);
+
+    tiramisu_MPI_cleanup();
+#endif
+    return 0;
+}
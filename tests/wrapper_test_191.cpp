@@ -0,0 +1,41 @@
+#include "wrapper_test_191.h"
+#include "Halide.h"
+
+#include <tiramisu/utils.h>
+#include <tiramisu/mpi_comm.h>
+#include <cstdlib>
+#include <iostream>
+
+int main() {
+#ifdef WITH_MPI
+    int rank = tiramisu_MPI_init();
+
+    Halide::Buffer<int> buff(10, 10, "buff");
+    Halide::Buffer<int> buff_ref(10, 10, "buff_ref");
+
+    for (int x = 0; x < 10; x++) {
+        for (int y = 0; y < 10; y++) {
+            buff(y, x) = rank * 1000 + x * 10 + y;
+            buff_ref(y, x) = rank * 1000 + x * 10 + y;
+        }
+    }
+    for (int y = 0; y < 10; y++) {
+        if (rank > 0) {
+            // put by the previous rank
+            buff_ref(y, 0) = (rank - 1) * 1000 + 80 + y;
+        }
+        if (rank < 9) {
+            // got from the next rank
+            buff_ref(y, 9) = (rank + 1) * 1000 + 10 + y;
+        }
+    }
+
+    dist_rma_halo(buff.raw_buffer());
+    MPI_Barrier(MPI_COMM_WORLD);
+    compare_buffers(TEST_NAME_STR, buff, buff_ref);
+    MPI_Barrier(MPI_COMM_WORLD);
+
+    tiramisu_MPI_cleanup();
+#endif
+    return 0;
+}
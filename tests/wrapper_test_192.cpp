@@ -0,0 +1,44 @@
+#include "wrapper_test_192.h"
+#include "Halide.h"
+
+#include <tiramisu/utils.h>
+#include <tiramisu/mpi_comm.h>
+#include <cstdlib>
+#include <iostream>
+
+int main() {
+#ifdef WITH_MPI
+    int rank = tiramisu_MPI_init();
+
+    // The ranks of the node exchange their halos with copies.
+    int *data = (int *) tiramisu_MPI_alloc_node_shared(100 * sizeof(int));
+    Halide::Buffer<int> buff(data, 10, 10);
+    Halide::Buffer<int> buff_ref(10, 10, "buff_ref");
+
+    for (int x = 0; x < 10; x++) {
+        for (int y = 0; y < 10; y++) {
+            buff(y, x) = rank * 1000 + x * 10 + y;
+            buff_ref(y, x) = rank * 1000 + x * 10 + y;
+        }
+    }
+    for (int y = 0; y < 10; y++) {
+        if (rank > 0) {
+            // put by the previous rank
+            buff_ref(y, 0) = (rank - 1) * 1000 + 80 + y;
+        }
+        if (rank < 9) {
+            // got from the next rank
+            buff_ref(y, 9) = (rank + 1) * 1000 + 10 + y;
+        }
+    }
+
+    dist_rma_node_shared_halo(buff.raw_buffer());
+    MPI_Barrier(MPI_COMM_WORLD);
+    compare_buffers(TEST_NAME_STR, buff, buff_ref);
+    MPI_Barrier(MPI_COMM_WORLD);
+
+    tiramisu_MPI_free_node_shared(data);
+    tiramisu_MPI_cleanup();
+#endif
+    return 0;
+}
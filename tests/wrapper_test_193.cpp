@@ -0,0 +1,39 @@
+#include "wrapper_test_193.h"
+#include "Halide.h"
+
+#include <tiramisu/utils.h>
+#include <tiramisu/mpi_comm.h>
+#include <cstdlib>
+#include <iostream>
+
+// The rank that owns the element i (blocks of 4 elements, 10 ranks).
+static int owner(int i) {
+    return (i / 4) % 10;
+}
+
+int main() {
+#ifdef WITH_MPI
+    int rank = tiramisu_MPI_init();
+
+    Halide::Buffer<int> in(80, "in");
+    Halide::Buffer<int> blur(79, "blur");
+    Halide::Buffer<int> blur_ref(79, "blur_ref");
+
+    // A rank only initializes the elements it owns.
+    for (int i = 0; i < 80; i++) {
+        in(i) = (owner(i) == rank) ? i * i : -1;
+    }
+    for (int i = 0; i < 79; i++) {
+        blur_ref(i) = (owner(i) == rank) ? i * i + (i + 1) * (i + 1) : 0;
+    }
+    init_buffer(blur, 0);
+
+    dist_block_cyclic_blur(in.raw_buffer(), blur.raw_buffer());
+    MPI_Barrier(MPI_COMM_WORLD);
+    compare_buffers(TEST_NAME_STR, blur, blur_ref);
+    MPI_Barrier(MPI_COMM_WORLD);
+
+    tiramisu_MPI_cleanup();
+#endif
+    return 0;
+}
@@ -0,0 +1,39 @@
+#include "wrapper_test_194.h"
+#include "Halide.h"
+
+#include <tiramisu/utils.h>
+#include <tiramisu/mpi_comm.h>
+#include <cstdlib>
+#include <iostream>
+
+int main() {
+#ifdef WITH_MPI
+    int rank = tiramisu_MPI_init();
+
+    Halide::Buffer<int> A(41, "A");
+    Halide::Buffer<int> B(40, "B");
+    Halide::Buffer<int> C(40, "C");
+    Halide::Buffer<int> C_ref(40, "C_ref");
+
+    // Only the rank 0 has the inputs.
+    for (int i = 0; i < 41; i++) {
+        A(i) = (rank == 0) ? i : -1;
+    }
+    for (int i = 0; i < 40; i++) {
+        B(i) = (rank == 0) ? 2 * i : -1;
+    }
+    // The rank 0 gets the whole output, the other ranks their block of 4 elements.
+    for (int i = 0; i < 40; i++) {
+        C_ref(i) = (rank == 0 || i / 4 == rank) ? 4 * i + 1 : 0;
+    }
+    init_buffer(C, 0);
+
+    dist_inferred_stencil(A.raw_buffer(), B.raw_buffer(), C.raw_buffer());
+    MPI_Barrier(MPI_COMM_WORLD);
+    compare_buffers(TEST_NAME_STR, C, C_ref);
+    MPI_Barrier(MPI_COMM_WORLD);
+
+    tiramisu_MPI_cleanup();
+#endif
+    return 0;
+}
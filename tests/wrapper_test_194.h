@@ -0,0 +1,25 @@
+#ifndef TIRAMISU_WRAPPER_TEST_194_H
+#define TIRAMISU_WRAPPER_TEST_194_H
+
+// Define these values for each new test
+#define TEST_NAME_STR       "Inferred data distribution"
+#define TEST_NUMBER_STR     "194"
+
+// --------------------------------------------------------
+// No need to modify anything in the following ------------
+// --------------------------------------------------------
+
+#include <tiramisu/utils.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+int dist_inferred_stencil(halide_buffer_t *, halide_buffer_t *, halide_buffer_t *);
+int dist_inferred_stencil_argv(void **args);
+
+extern const struct halide_filter_metadata_t halide_pipeline_aot_metadata;
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif //TIRAMISU_WRAPPER_TEST_194_H
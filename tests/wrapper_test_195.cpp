@@ -0,0 +1,40 @@
+#include "wrapper_test_195.h"
+#include "Halide.h"
+
+#include <tiramisu/utils.h>
+#include <tiramisu/mpi_comm.h>
+#include <cstdlib>
+#include <iostream>
+
+int main() {
+#ifdef WITH_MPI
+    int rank = tiramisu_MPI_init();
+
+    Halide::Buffer<int> buffer(100, 100, "buffer");
+    Halide::Buffer<int> ref(100, 100, "ref");
+
+    for (int i = 0; i < 100; i++) {
+        for (int j = 0; j < 100; j++) {
+            buffer(j,i) = rank * 1000 + j;
+            ref(j,i) = rank * 1000 + j;
+        }
+    }
+    for (int i = 0; i < 100; i++) {
+        if (rank > 0) {
+            for (int j = 0; j < 4; j++) {
+                ref(j,i) = (rank - 1) * 1000 + 96 + j;
+            }
+        }
+        if (rank < 9) {
+            ref(40,i) = (rank + 1) * 1000 + 20;
+        }
+    }
+    dist_aggregated_halo(buffer.raw_buffer());
+    MPI_Barrier(MPI_COMM_WORLD);
+    compare_buffers(TEST_NAME_STR, buffer, ref);
+    MPI_Barrier(MPI_COMM_WORLD);
+
+    tiramisu_MPI_cleanup();
+#endif
+    return 0;
+}
@@ -0,0 +1,25 @@
+#include "Halide.h"
+#include "wrapper_test_196.h"
+
+#include <tiramisu/utils.h>
+
+#define ROWS 64
+#define COLS 256
+
+int main(int, char **)
+{
+    Halide::Buffer<int32_t> a_buf(COLS, ROWS);
+    Halide::Buffer<int32_t> out_buf(COLS, ROWS), out_ref(COLS, ROWS);
+
+    for (int i = 0; i < ROWS; i++)
+        for (int j = 0; j < COLS; j++)
+        {
+            a_buf(j, i) = (i * COLS + j) % 17 - 8;
+            out_ref(j, i) = (j == 0) ? a_buf(j, i) + 100 : a_buf(j, i) * 2;
+        }
+
+    func(a_buf.raw_buffer(), out_buf.raw_buffer());
+    compare_buffers("non-temporal stores", out_buf, out_ref);
+
+    return 0;
+}
@@ -0,0 +1,26 @@
+#include "Halide.h"
+#include "wrapper_test_197.h"
+
+#include <tiramisu/utils.h>
+
+#define ROWS 600
+#define COLS 1000
+
+int main(int, char **)
+{
+    Halide::Buffer<int32_t> a_buf(COLS, ROWS + 2);
+    Halide::Buffer<int32_t> b_buf(COLS, ROWS), b_ref(COLS, ROWS);
+
+    for (int i = 0; i < ROWS + 2; i++)
+        for (int j = 0; j < COLS; j++)
+            a_buf(j, i) = (i * COLS + j) % 11 - 5;
+
+    for (int i = 0; i < ROWS; i++)
+        for (int j = 0; j < COLS; j++)
+            b_ref(j, i) = (a_buf(j, i) + a_buf(j, i + 1) + a_buf(j, i + 2)) * 3;
+
+    func(a_buf.raw_buffer(), b_buf.raw_buffer());
+    compare_buffers("NUMA first touch and huge pages", b_buf, b_ref);
+
+    return 0;
+}
@@ -0,0 +1,38 @@
+#include "Halide.h"
+#include "wrapper_test_198.h"
+
+#include <tiramisu/utils.h>
+
+#define NN 8
+
+int main(int, char **)
+{
+    Halide::Buffer<int32_t> a_buf(NN, NN), i_buf(NN, NN);
+    Halide::Buffer<int32_t> c_buf(NN, NN), c_ref(NN, NN);
+    Halide::Buffer<int32_t> e_buf(NN), e_ref(NN);
+
+    for (int i = 0; i < NN; i++)
+        for (int j = 0; j < NN; j++)
+        {
+            a_buf(j, i) = ((i + j) % 3 == 0) ? 1 : 0;
+            i_buf(j, i) = (i + 2 * j) % 5 - 2;
+            c_ref(j, i) = i_buf(j, i);
+        }
+
+    for (int i = 0; i < NN; i++)
+        for (int j = 0; j < NN; j++)
+            for (int k = 0; k < NN; k++)
+                c_ref(j, i) += c_ref(i, j) * a_buf(k, i);
+
+    for (int i = 0; i < NN; i++)
+        e_ref(i) = i_buf(0, i);
+    for (int i = 0; i < NN - 1; i++)
+        for (int k = 0; k < NN; k++)
+            e_ref(i) += e_ref(i + 1) * a_buf(k, i);
+
+    func(a_buf.raw_buffer(), i_buf.raw_buffer(), c_buf.raw_buffer(), e_buf.raw_buffer());
+    compare_buffers("aliased accesses are not promoted", c_buf, c_ref);
+    compare_buffers("disjoint accesses are promoted", e_buf, e_ref);
+
+    return 0;
+}
@@ -0,0 +1,32 @@
+#include "Halide.h"
+#include "wrapper_test_199.h"
+
+#include <tiramisu/utils.h>
+
+#define ROWS 10
+#define COLS 21
+// The padded row length: COLS + (vector length - 1).
+#define PADDED_COLS 28
+
+int main(int, char **)
+{
+    Halide::Buffer<int32_t> a_buf(PADDED_COLS, ROWS);
+    Halide::Buffer<int32_t> b_buf(PADDED_COLS, ROWS);
+
+    for (int i = 0; i < ROWS; i++)
+        for (int j = 0; j < PADDED_COLS; j++)
+            a_buf(j, i) = (i * COLS + j) % 13 - 6;
+
+    func(a_buf.raw_buffer(), b_buf.raw_buffer());
+
+    // The results computed in the padding are ignored.
+    for (int i = 0; i < ROWS; i++)
+        for (int j = 0; j < COLS; j++)
+            if (b_buf(j, i) != a_buf(j, i) * 3 + 1)
+            {
+                std::cerr << "padded vector tail: wrong value at (" << i << ", " << j << ")" << std::endl;
+                return 1;
+            }
+
+    return 0;
+}
@@ -0,0 +1,48 @@
+#include "wrapper_test_201.h"
+#include "Halide.h"
+
+#include <tiramisu/utils.h>
+#include <tiramisu/mpi_comm.h>
+#include <cstdlib>
+#include <iostream>
+
+#define RANKS 10
+#define STEPS 5
+
+int main() {
+#ifdef WITH_MPI
+    int rank = tiramisu_MPI_init();
+
+    Halide::Buffer<int> buffer(10, "buffer");
+    Halide::Buffer<int> ref(10, "ref");
+
+    // Simulate the time loop on all the ranks.
+    int values[RANKS][10];
+    for (int r = 0; r < RANKS; r++) {
+        for (int x = 0; x < 10; x++) {
+            values[r][x] = r * 100 + x;
+        }
+    }
+    for (int t = 0; t < STEPS; t++) {
+        for (int r = 0; r < RANKS - 1; r++) {
+            values[r][9] = values[r + 1][1];
+        }
+        for (int r = 0; r < RANKS; r++) {
+            values[r][1] += values[r][9];
+        }
+    }
+
+    for (int x = 0; x < 10; x++) {
+        buffer(x) = rank * 100 + x;
+        ref(x) = values[rank][x];
+    }
+
+    dist_persistent_halo(buffer.raw_buffer());
+    MPI_Barrier(MPI_COMM_WORLD);
+    compare_buffers(TEST_NAME_STR, buffer, ref);
+    MPI_Barrier(MPI_COMM_WORLD);
+
+    tiramisu_MPI_cleanup();
+#endif
+    return 0;
+}
@@ -0,0 +1,29 @@
+#include "Halide.h"
+#include "wrapper_test_202.h"
+
+#include <tiramisu/utils.h>
+
+#define ROWS 64
+#define COLS 128
+
+int main(int, char **)
+{
+    Halide::Buffer<int32_t> a_buf(COLS, ROWS);
+    Halide::Buffer<int32_t> out_buf(2 * COLS, ROWS), out_ref(2 * COLS, ROWS);
+    Halide::Buffer<int32_t> out2_buf(COLS, ROWS), out2_ref(COLS, ROWS);
+
+    for (int i = 0; i < ROWS; i++)
+        for (int j = 0; j < COLS; j++)
+        {
+            a_buf(j, i) = (i * COLS + j) % 17 - 8;
+            out_ref(2 * j, i) = a_buf(j, i) * 2;
+            out_ref(2 * j + 1, i) = a_buf(j, i) + 100;
+            out2_ref(j, i) = a_buf(j, i) - 1;
+        }
+
+    func(a_buf.raw_buffer(), out_buf.raw_buffer(), out2_buf.raw_buffer());
+    compare_buffers("non-temporal stores fused with regular stores", out_buf, out_ref);
+    compare_buffers("non-temporal stores into a second buffer", out2_buf, out2_ref);
+
+    return 0;
+}
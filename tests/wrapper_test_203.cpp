@@ -0,0 +1,51 @@
+#include "wrapper_test_203.h"
+#include "Halide.h"
+
+#include <tiramisu/utils.h>
+#include <tiramisu/mpi_comm.h>
+#include <cstdlib>
+#include <iostream>
+
+int main() {
+#ifdef WITH_MPI
+    int rank = tiramisu_MPI_init();
+
+    Halide::Buffer<int> buff_in(8, 4, "buff_in");
+    Halide::Buffer<int> buff_out(8, 4, 3, "buff_out");
+    Halide::Buffer<int> buff_comp(16, 16, 3, "buff_comp");
+    Halide::Buffer<int> ref(8, 4, 3, "ref");
+    Halide::Buffer<int> ref_comp(16, 16, 3, "ref_comp");
+
+    for (int x = 0; x < 4; x++) {
+        for (int y = 0; y < 8; y++) {
+            buff_in(y,x) = rank * 1000 + x * 8 + y;
+        }
+    }
+    for (int t = 0; t < 3; t++) {
+        for (int x = 0; x < 4; x++) {
+            for (int y = 0; y < 8; y++) {
+                buff_out(y,x,t) = -1;
+                ref(y,x,t) = (rank > 0) ? (rank - 1) * 1000 + x * 8 + y : -1;
+            }
+        }
+        for (int i = 0; i < 16; i++) {
+            for (int j = 0; j < 16; j++) {
+                ref_comp(j,i,t) = t + i * 16 + j;
+            }
+        }
+    }
+
+    // Run the function twice: the requests released by tiramisu_MPI_Testsome
+    // and tiramisu_MPI_Waitall in the first call are reused by the second one.
+    for (int run = 0; run < 2; run++) {
+        dist_nonblock_progress(buff_in.raw_buffer(), buff_out.raw_buffer(), buff_comp.raw_buffer());
+        MPI_Barrier(MPI_COMM_WORLD);
+        compare_buffers(TEST_NAME_STR, buff_out, ref);
+        compare_buffers(TEST_NAME_STR, buff_comp, ref_comp);
+        MPI_Barrier(MPI_COMM_WORLD);
+    }
+
+    tiramisu_MPI_cleanup();
+#endif
+    return 0;
+}
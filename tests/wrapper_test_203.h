@@ -0,0 +1,25 @@
+#ifndef TIRAMISU_WRAPPER_TEST_203_H
+#define TIRAMISU_WRAPPER_TEST_203_H
+
+// Define these values for each new test
+#define TEST_NAME_STR       "Distributed nonblocking transfers tested while computing"
+#define TEST_NUMBER_STR     "203"
+
+// --------------------------------------------------------
+// No need to modify anything in the following ------------
+// --------------------------------------------------------
+
+#include <tiramisu/utils.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+int dist_nonblock_progress(halide_buffer_t *, halide_buffer_t *, halide_buffer_t *);
+int dist_nonblock_progress_argv(void **args);
+
+extern const struct halide_filter_metadata_t halide_pipeline_aot_metadata;
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif //TIRAMISU_WRAPPER_TEST_203_H